@@ -1684,7 +1684,9 @@ def resample(
     specified set of axes. Given an input array (``source``) and target shape
     (``shape``), it returns a compatible array of the specified configuration.
     This is implemented using a sequence of successive 1D resampling steps for
-    each mismatched axis.
+    each mismatched axis. When exactly two adjacent axes (e.g., the rows and
+    columns of an image) of a CPU array are resampled, both steps are fused to
+    avoid a full-size intermediate array.
 
     Example usage:
 
@@ -1778,28 +1780,33 @@ def resample(
             "drjit.resample(): 'source' and 'shape' must have the same number of axes."
         )
 
-    for i in reversed(range(ndim)):
-        source_res = source_shape[i]
-        target_res = shape[i]
-
-        if source_res == target_res:
-            continue
-
+    def get_resampler(i):
         # Cache resampler in case it can be reused
-        key = (source_res, target_res, filter, filter_radius)
+        key = (source_shape[i], shape[i], filter, filter_radius)
 
         resampler = _resample_cache.get(key, None)
         if resampler is None:
             resampler = detail.Resampler(
-                source_res=source_res,
-                target_res=target_res,
+                source_res=source_shape[i],
+                target_res=shape[i],
                 filter=filter,
                 filter_radius=filter_radius,
             )
             _resample_cache[key] = resampler
+        return resampler
 
+    axes = [i for i in range(ndim) if source_shape[i] != shape[i]]
+
+    # Resample two adjacent axes in one fused step on the CPU
+    if len(axes) == 2 and axes[1] == axes[0] + 1 and not is_jit_v(tp):
+        value = detail.Resampler.resample_2d_fwd(
+            get_resampler(axes[0]), get_resampler(axes[1]),
+            value, strides[axes[1]])
+        axes = []
+
+    for i in reversed(axes):
         value = custom(_ResampleOp,
-            resampler=resampler,
+            resampler=get_resampler(i),
             source=value,
             stride=strides[i])
 
@@ -1920,6 +1927,12 @@ def moveaxis(arg: ArrayBase, /, source: Union[int, Tuple[int, ...]], destination
     Dimensions of that are not explicitly moved remain in their original order
     and appear at the positions not specified in the destination. Negative axis
     values count backwards from the end.
+
+    The result is a strided view that references the storage of the input
+    tensor. Its entries are only copied into a contiguous array when an
+    operation requires this, in which case the reordering is fused into a
+    single gather operation together with any other slicing or axis
+    permutations applied to the input.
     """
 
     if not is_tensor_v(arg):
@@ -1939,27 +1952,11 @@ def moveaxis(arg: ArrayBase, /, source: Union[int, Tuple[int, ...]], destination
     for dest, src in sorted(zip(destination_l, source_l)):
         order.insert(dest, src)
 
+    strides_in, offset = detail.tensor_layout(arg)
     shape_out = tuple(shape_in[i] for i in order)
-    strides_in = _compute_strides(shape_in)
-    strides_out = _compute_strides(shape_out)
-
-    last_axis = 0
-    for i, j in enumerate(order):
-        if i != j:
-            last_axis = i + 1
-
-    arr = arg.array
-    index_out = arange(uint32_array_t(arr), prod(shape_in))
-    index_in = 0
+    strides_out = tuple(strides_in[i] for i in order)
 
-    for i in range(last_axis):
-        pos = index_out // strides_out[i]
-        index_out -= pos * strides_out[i]
-        index_in += pos * strides_in[order[i]]
-
-    index_in += index_out
-
-    return type(arg)(gather(type(arr), arr, index_in, mode=ReduceMode.Permute), shape_out)
+    return detail.tensor_view(arg, shape_out, strides_out, offset)
 
 
 def take(value: ArrayT, index: Union[int, ArrayBase], axis: int = 0) -> ArrayT:
@@ -2249,7 +2246,8 @@ def upsample(t, shape=None, scale_factor=None):
         texture = type(t)(shape[:-1], channels,
                           use_accel=t.use_accel(),
                           filter_mode=t.filter_mode(),
-                          wrap_mode=t.wrap_mode())
+                          wrap_mode=t.wrap_mode(),
+                          layout=t.layout())
         texture.set_value(data)
 
         return texture
@@ -2352,6 +2350,149 @@ def binary_search(start, end, pred):
 
     return start
 
+
+def _eytzinger_pad(dtype):
+    """Return the value used to pad an Eytzinger layout of type ``dtype``"""
+    if is_float_v(dtype):
+        return float('inf')
+    bits = 8 * itemsize_v(dtype)
+    return (1 << (bits - 1 if is_signed_v(dtype) else bits)) - 1
+
+
+def eytzinger(sorted: ArrayT, /) -> ArrayT:
+    """
+    Reorder a sorted array into the *Eytzinger* (breadth-first) layout
+    expected by :py:func:`drjit.searchsorted()`.
+
+    The function arranges the entries of ``sorted`` as the nodes of a complete
+    binary search tree stored in breadth-first order. It pads the input with
+    the largest value of its type (or infinity) so that the tree is perfectly
+    balanced, hence the output has ``2**h - 1`` entries, where ``h`` is the
+    smallest integer such that this value is greater than or equal to
+    ``len(sorted)``.
+
+    The first levels of the tree are stored in a small contiguous region at
+    the beginning of the array, which remains in the cache when many queries
+    traverse the tree in parallel. A binary search over the original array
+    instead accesses entries that are spread over the entire array during its
+    first steps.
+
+    Build this layout once per table and then pass it to any number of calls
+    to :py:func:`drjit.searchsorted()`.
+
+    Args:
+        sorted (drjit.ArrayBase): A 1D array sorted in ascending order.
+
+    Returns:
+        drjit.ArrayBase: The reordered and padded array.
+    """
+    tp = type(sorted)
+    if not is_array_v(tp) or depth_v(tp) != 1 or not is_dynamic_v(tp):
+        raise TypeError("drjit.eytzinger(): expected a dynamic 1D array!")
+
+    n = len(sorted)
+    if n == 0:
+        return tp()
+
+    h = n.bit_length()
+    size = (1 << h) - 1
+    Index = uint32_array_t(tp)
+
+    # Node 'k' (numbered from 1) at depth 'd' refers to the sorted entry
+    # '(2 * (k - 2**d) + 1) * 2**(h - d - 1) - 1'
+    k = arange(Index, 1, size + 1)
+    d = log2i(k)
+    index = ((((k - (Index(1) << d)) << 1) + 1) << (h - 1 - d)) - 1
+
+    active = index < n
+    return select(active, gather(tp, sorted, index, active),
+                  _eytzinger_pad(tp))
+
+
+def searchsorted(
+    sorted: ArrayT,
+    value: ArrayT,
+    /,
+    side: Literal['left', 'right'] = 'left',
+    eytzinger: Optional[ArrayT] = None
+) -> ArrayBase:
+    """
+    Find the indices where elements of ``value`` should be inserted into the
+    array ``sorted`` to maintain the order.
+
+    The function follows the conventions of ``numpy.searchsorted()``: for each
+    entry ``v`` of ``value``, it returns the index ``i`` of the first element
+    of ``sorted`` such that ``v <= sorted[i]`` (``side='left'``) or ``v <
+    sorted[i]`` (``side='right'``), or ``len(sorted)`` if there is no such
+    element. A typical use case is the inversion of a cumulative distribution
+    function, e.g., when importance sampling an environment map.
+
+    Unlike :py:func:`drjit.binary_search()`, this operation is branch-free: it
+    performs the same fixed number of steps for every entry, which trace into
+    straight-line code without a symbolic loop.
+
+    When queried many times, it is advisable to reorder the table into the
+    cache-friendly layout produced by :py:func:`drjit.eytzinger()` and to
+    pass it via the ``eytzinger`` parameter. The ``sorted`` array must still
+    be specified, though only its size is used in this case.
+
+    Args:
+        sorted (drjit.ArrayBase): A 1D array sorted in ascending order.
+
+        value (drjit.ArrayBase): The values to search for.
+
+        side (str): Either ``'left'`` or ``'right'``, see above.
+
+        eytzinger (drjit.ArrayBase | None): Optional output of
+          :py:func:`drjit.eytzinger()` for the array ``sorted``.
+
+    Returns:
+        drjit.ArrayBase: A 32-bit unsigned integer array with the same
+        shape as ``value``.
+    """
+    tp = type(sorted)
+    if not is_array_v(tp) or depth_v(tp) != 1 or not is_dynamic_v(tp):
+        raise TypeError("drjit.searchsorted(): 'sorted' must be a dynamic 1D array!")
+    if side != 'left' and side != 'right':
+        raise ValueError("drjit.searchsorted(): 'side' must equal 'left' or 'right'!")
+
+    value = tp(value)
+    Index = uint32_array_t(tp)
+    n = len(sorted)
+
+    if side == 'left':
+        pred = lambda a: a < value
+    else:
+        pred = lambda a: a <= value
+
+    if n == 0:
+        return zeros(Index, width(value))
+
+    if eytzinger is not None:
+        h = n.bit_length()
+        if len(eytzinger) != (1 << h) - 1:
+            raise RuntimeError("drjit.searchsorted(): 'eytzinger' does not "
+                               "match the size of 'sorted'!")
+
+        # Descend the tree, the path encodes the number of smaller elements
+        k = Index(1)
+        for _ in range(h):
+            k = (k << 1) + select(pred(gather(tp, eytzinger, k - 1)),
+                                  Index(1), Index(0))
+
+        return minimum(k - (1 << h), n)
+
+    # Branch-free binary search with a uniform number of steps
+    base, size = Index(0), n
+    while size > 1:
+        half = size >> 1
+        base = select(pred(gather(tp, sorted, base + half - 1)),
+                      base + half, base)
+        size -= half
+
+    return base + select(pred(gather(tp, sorted, base)), Index(1), Index(0))
+
+
 # Represents the frozen function passed to the decorator without arguments
 F = TypeVar("F")
 # Represents the frozen function passed to the decorator with arguments
@@ -2455,7 +2596,9 @@ def freeze(
 
     Frozen functions support arguments with a different variable *width* (see
     :py:func:`dr.with() <drjit.width>`) without re-tracing, as long as the sets of
-    variables of the same width stay consistent.
+    variables of the same width stay consistent. Literal input variables whose
+    width matches that of an opaque input are treated in the same way, unless
+    a literal output may have been computed from them.
 
     Some constructions are problematic and should be avoided in frozen functions.
 
@@ -2601,10 +2744,32 @@ def freeze(
                 """
                 return self.frozen.n_cached_recordings
 
+            @property
+            def stats(self):
+                """
+                Returns a snapshot of timing and hit/miss statistics of the
+                frozen function (of type ``drjit.detail.FrozenFunctionStats``).
+
+                The snapshot contains the cumulative (``total``) and most recent
+                (``last``) time in milliseconds spent in the ``traverse_input``,
+                ``eval``, ``function``, ``record``, ``replay`` phases and the
+                call as a whole (``total``). It furthermore counts the number of
+                calls (``n_calls``), recordings (``n_records``), successful
+                replays (``n_replays``), failed dry-runs
+                (``n_dry_run_failures``), repeated input traversals caused by
+                the auto-opaque feature (``n_auto_opaque_retraversals``) and
+                evicted recordings (``n_evictions``). Finally, ``hits`` maps the
+                identifier of every cached recording to the number of times it
+                has been replayed.
+
+                The statistics are reset by :py:meth:`clear`.
+                """
+                return self.frozen.stats
+
             def clear(self):
                 """
                 Clears the recordings of the frozen function, and resets the
-                ``n_recordings`` counter. The reference to the function is still
+                ``n_recordings`` counter and statistics. The reference to the function is still
                 kept, and the frozen function can be called again to re-trace
                 new recordings.
                 """
@@ -3187,6 +3352,8 @@ def func(
 newaxis = None
 
 from . import hashgrid as hashgrid
+from . import texture as texture
 from . import nn as nn
+from ._io import save as save, load as load
 
 del overload, Optional
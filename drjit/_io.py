@@ -0,0 +1,329 @@
+import drjit as dr
+import dataclasses
+import importlib
+import json
+import math
+import struct
+from typing import Any, Dict, List, Sequence, Tuple
+
+# The file format written by :py:func:`save()` is organized as follows:
+#
+# - Bytes 0-7: the magic string ``DRJITSAV``
+# - Bytes 8-11: format version (little endian ``uint32``), currently 1
+# - Bytes 12-15: reserved, zero
+# - Bytes 16-23: size of the header in bytes (little endian ``uint64``)
+# - Bytes 24+: the header, a UTF-8 encoded JSON document
+# - The data section, which starts at the first multiple of
+#   ``ALIGNMENT`` following the header.
+#
+# The header encodes the saved PyTree as a nested JSON object. Each node is
+# an object with a single key that specifies its kind:
+#
+# - ``{"array": {...}}``: a flat array or tensor with fields ``type``
+#   (module and name of the Dr.Jit type), ``dtype`` (name of the
+#   ``drjit.VarType``), ``shape``, ``offset`` (relative to the start of the
+#   data section, a multiple of ``ALIGNMENT``), and ``nbytes``. The entries
+#   are stored contiguously in C (row-major) order.
+# - ``{"nested": {"type": ..., "items": [...]}}``: a nested array type
+#   (e.g., ``Array3f`` or ``Matrix4f``), stored via its components.
+# - ``{"list": [...]}``, ``{"tuple": [...]}``: Python sequences.
+# - ``{"dict": [[key, node], ...]}``: a dictionary with scalar keys.
+# - ``{"struct": {"type": ..., "fields": {...}}}``: a data class or a type
+#   with a ``DRJIT_STRUCT`` annotation. :py:func:`load()` only constructs
+#   such types when the caller lists them in its ``types`` parameter.
+# - ``{"value": ...}``: ``None``, or a Python ``bool``, ``int``, ``float``,
+#   or ``str``.
+
+MAGIC = b'DRJITSAV'
+VERSION = 1
+ALIGNMENT = 64
+
+# Mapping from Dr.Jit types to 'struct' format characters
+_formats = {
+    dr.VarType.Bool: '?',
+    dr.VarType.Int8: 'b',
+    dr.VarType.UInt8: 'B',
+    dr.VarType.Int16: 'h',
+    dr.VarType.UInt16: 'H',
+    dr.VarType.Int32: 'i',
+    dr.VarType.UInt32: 'I',
+    dr.VarType.Int64: 'q',
+    dr.VarType.UInt64: 'Q',
+    dr.VarType.Float16: 'e',
+    dr.VarType.Float32: 'f',
+    dr.VarType.Float64: 'd'
+}
+
+
+def _type_name(tp: type) -> List[str]:
+    return [tp.__module__, tp.__qualname__]
+
+
+def _array_lookup(name: List[str]) -> type:
+    """
+    Look up a Dr.Jit array type by name. Only types defined within the
+    ``drjit`` package are accepted, since the result is subsequently called.
+    """
+    module, qualname = name
+    if module != 'drjit' and not module.startswith('drjit.'):
+        raise RuntimeError(f"drjit.load(): refusing to load non-Dr.Jit type "
+                           f"'{module}.{qualname}'.")
+    value = importlib.import_module(module)
+    for part in qualname.split('.'):
+        value = getattr(value, part, None)
+    if not isinstance(value, type) or not dr.is_array_v(value):
+        raise RuntimeError(f"drjit.load(): '{module}.{qualname}' is not a "
+                           "Dr.Jit array type.")
+    return value
+
+
+def _struct_lookup(name: List[str], types: Dict[Tuple[str, str], type]) -> type:
+    """Look up a data class or ``DRJIT_STRUCT`` type in the caller's allowlist"""
+    tp = types.get(tuple(name))
+    if tp is None:
+        raise RuntimeError(f"drjit.load(): type '{name[0]}.{name[1]}' was not "
+                           "specified via the 'types' parameter.")
+    return tp
+
+
+def _encode(value: Any, arrays: List[Tuple[Any, Dict]], offset: List[int]) -> Dict:
+    """Convert a PyTree into a JSON node and collect its arrays"""
+    tp = type(value)
+
+    if dr.is_array_v(tp):
+        if dr.is_tensor_v(tp) or dr.depth_v(tp) == 1:
+            vt = dr.type_v(tp)
+            if vt not in _formats:
+                raise TypeError(f"drjit.save(): unsupported array type '{tp.__name__}'.")
+            shape = tuple(dr.shape(value))
+            nbytes = math.prod(shape) * dr.itemsize_v(tp)
+            node = {
+                'type': _type_name(tp),
+                'dtype': vt.name,
+                'shape': list(shape),
+                'offset': offset[0],
+                'nbytes': nbytes
+            }
+            offset[0] += (nbytes + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+            arrays.append((value, node))
+            return {'array': node}
+        else:
+            return {'nested': {
+                'type': _type_name(tp),
+                'items': [_encode(v, arrays, offset) for v in value]
+            }}
+    elif tp is list or tp is tuple:
+        return {tp.__name__: [_encode(v, arrays, offset) for v in value]}
+    elif tp is dict:
+        return {'dict': [[k, _encode(v, arrays, offset)] for k, v in value.items()]}
+    elif value is None or tp in (bool, int, float, str):
+        return {'value': value}
+
+    ds = getattr(tp, 'DRJIT_STRUCT', None)
+    if isinstance(ds, dict):
+        names = ds.keys()
+    elif dataclasses.is_dataclass(tp):
+        names = [f.name for f in dataclasses.fields(tp)]
+    else:
+        raise TypeError(f"drjit.save(): unsupported type '{tp.__name__}'.")
+
+    return {'struct': {
+        'type': _type_name(tp),
+        'fields': {k: _encode(getattr(value, k), arrays, offset) for k in names}
+    }}
+
+
+def save(path: str, value: Any) -> None:
+    """
+    Save a Dr.Jit array, tensor, or PyTree to a file.
+
+    Dr.Jit arrays and tensors are stored in binary form, while the structure
+    of the PyTree (lists, tuples, dictionaries, data classes and types with a
+    ``DRJIT_STRUCT`` annotation, along with Python scalars and strings) is
+    recorded in a small header. The arrays are written without conversion
+    into a data section, where each one starts at a 64 byte aligned offset.
+    This layout lets :py:func:`drjit.load()` map the file into memory instead
+    of reading it. Please refer to the source code of the ``drjit._io`` module
+    for a precise description of the format.
+
+    The function evaluates the arrays before writing them to disk. Derivative
+    tracking information is not saved. Data classes and ``DRJIT_STRUCT`` types
+    must be passed to the ``types`` parameter of :py:func:`drjit.load()` when
+    reading the file.
+
+    Args:
+        path (str | os.PathLike): Path of the file to create.
+
+        value (object): The array, tensor, or PyTree to save.
+    """
+    arrays, offset = [], [0]
+    tree = _encode(value, arrays, offset)
+    dr.eval(*[a for a, _ in arrays])
+
+    header = json.dumps(tree, separators=(',', ':')).encode('utf-8')
+    prefix = MAGIC + struct.pack('<IIQ', VERSION, 0, len(header))
+    start = len(prefix) + len(header)
+    padding = (ALIGNMENT - start % ALIGNMENT) % ALIGNMENT
+
+    with open(path, 'wb') as f:
+        f.write(prefix)
+        f.write(header)
+        f.write(b'\0' * padding)
+
+        pos = 0
+        for array, node in arrays:
+            f.write(b'\0' * (node['offset'] - pos))
+            if node['nbytes'] > 0:
+                f.write(dr.detach(array).memview())
+            pos = node['offset'] + node['nbytes']
+
+
+def _read_chunked(f, tp: type, node: Dict, start: int, chunk_size: int):
+    """
+    Read a flat array in pieces of at most ``chunk_size`` bytes, each of which
+    is transferred before the next one is read.
+    """
+    Index = dr.uint32_array_t(tp)
+    fmt, itemsize = _formats[dr.type_v(tp)], dr.itemsize_v(tp)
+    size = node['nbytes'] // itemsize
+    step = max(chunk_size // itemsize, 1)
+    buf = bytearray(min(step, size) * itemsize)
+    result = dr.empty(tp, size)
+
+    f.seek(start + node['offset'])
+    for i in range(0, size, step):
+        count = min(step, size - i)
+        view = memoryview(buf)[:count * itemsize]
+        if f.readinto(view) != len(view):
+            raise RuntimeError("drjit.load(): unexpected end of file.")
+
+        dr.scatter(result, tp(view.cast(fmt)), dr.arange(Index, i, i + count))
+
+        # The buffer is reused by the next iteration
+        dr.eval(result)
+        dr.sync_thread()
+
+    return result
+
+
+def _decode(node: Dict, data, f, start: int, chunk_size: int,
+            types: Dict[Tuple[str, str], type]) -> Any:
+    """Convert a JSON node back into a PyTree"""
+    kind, value = next(iter(node.items()))
+
+    if kind == 'array':
+        tp = _array_lookup(value['type'])
+        if dr.type_v(tp).name != value['dtype']:
+            raise RuntimeError(f"drjit.load(): type mismatch for '{tp.__name__}'.")
+        shape = tuple(value['shape'])
+
+        if value['nbytes'] == 0:
+            return dr.zeros(tp, shape if dr.is_tensor_v(tp) else 0)
+
+        if data is None and dr.is_dynamic_v(tp):
+            flat_tp = dr.array_t(tp) if dr.is_tensor_v(tp) else tp
+            result = _read_chunked(f, flat_tp, value, start, chunk_size)
+            return tp(result, shape) if dr.is_tensor_v(tp) else result
+
+        offset, nbytes = value['offset'], value['nbytes']
+        if data is None:
+            f.seek(start + offset)
+            view = memoryview(bytearray(f.read(nbytes)))
+        else:
+            view = data[start + offset:start + offset + nbytes]
+
+        if len(view) != nbytes:
+            raise RuntimeError("drjit.load(): unexpected end of file.")
+
+        fmt = _formats[dr.type_v(tp)]
+        return tp(view.cast(fmt, shape))
+    elif kind == 'nested':
+        tp = _array_lookup(value['type'])
+        return tp(*[_decode(v, data, f, start, chunk_size, types) for v in value['items']])
+    elif kind == 'list':
+        return [_decode(v, data, f, start, chunk_size, types) for v in value]
+    elif kind == 'tuple':
+        return tuple(_decode(v, data, f, start, chunk_size, types) for v in value)
+    elif kind == 'dict':
+        return {k: _decode(v, data, f, start, chunk_size, types) for k, v in value}
+    elif kind == 'value':
+        return value
+    elif kind == 'struct':
+        tp = _struct_lookup(value['type'], types)
+        fields = {k: _decode(v, data, f, start, chunk_size, types)
+                  for k, v in value['fields'].items()}
+        if dataclasses.is_dataclass(tp):
+            return tp(**fields)
+        result = tp()
+        for k, v in fields.items():
+            setattr(result, k, v)
+        return result
+    else:
+        raise RuntimeError(f"drjit.load(): unknown node type '{kind}'.")
+
+
+def load(path: str, mmap: bool = True, chunk_size: int = 1 << 26,
+         types: Sequence[type] = ()) -> Any:
+    """
+    Load a Dr.Jit array, tensor, or PyTree from a file created by
+    :py:func:`drjit.save()`.
+
+    By default, the function maps the file into memory instead of reading it.
+    CPU (LLVM) arrays then directly reference the mapped memory, and the
+    operating system only reads the parts of the file that computation
+    actually accesses. This works with files larger than the main memory of
+    the machine. The mapping is private, hence modifications of the loaded
+    arrays are not written back to the file.
+
+    When ``mmap=False``, the function instead reads each array in pieces of
+    at most ``chunk_size`` bytes (64 MiB by default), which it transfers to
+    the array's device before reading the next one. Each array is then
+    stored in memory managed by Dr.Jit, and no further copy of the file's
+    contents is created.
+
+    The file header names the types of the stored objects, which the
+    function subsequently constructs. To prevent a crafted file from invoking
+    arbitrary Python code, array nodes must refer to Dr.Jit array types, and
+    data classes or types with a ``DRJIT_STRUCT`` annotation are only
+    constructed when they are listed in the ``types`` parameter. The function
+    raises an exception when it encounters any other type.
+
+    Args:
+        path (str | os.PathLike): Path of the file to load.
+
+        mmap (bool): Map the file into memory? (default: ``True``)
+
+        chunk_size (int): Size of the pieces read when ``mmap=False``.
+
+        types (Sequence[type]): Data classes and ``DRJIT_STRUCT`` types that
+          may be constructed while loading the file. (default: ``()``)
+
+    Returns:
+        object: The array, tensor, or PyTree that was saved.
+    """
+    import mmap as _mmap
+
+    with open(path, 'rb') as f:
+        prefix = f.read(24)
+        if len(prefix) != 24 or prefix[:8] != MAGIC:
+            raise RuntimeError(f"drjit.load(): '{path}' is not a Dr.Jit file.")
+
+        version, _, header_size = struct.unpack('<IIQ', prefix[8:])
+        if version != VERSION:
+            raise RuntimeError(f"drjit.load(): unsupported format version {version}.")
+
+        tree = json.loads(f.read(header_size).decode('utf-8'))
+        start = 24 + header_size
+        start += (ALIGNMENT - start % ALIGNMENT) % ALIGNMENT
+
+        data = None
+        if mmap:
+            f.seek(0, 2)
+            if f.tell() > start:
+                # Copy-on-write mapping: Dr.Jit may write to arrays in place
+                data = memoryview(_mmap.mmap(f.fileno(), 0, access=_mmap.ACCESS_COPY))
+            else:
+                data = memoryview(b'')
+
+        allowed = {tuple(_type_name(tp)): tp for tp in types}
+        return _decode(tree, data, f, start, chunk_size, allowed)
@@ -0,0 +1,273 @@
+import drjit as dr
+from typing import Tuple, TypeVar
+
+ArrayT = TypeVar("ArrayT", bound=dr.ArrayBase)
+
+
+def _compute_strides(shape: Tuple[int, ...]) -> Tuple[int, ...]:
+    """Turn a shape tuple into a C-style strides tuple"""
+    val, ndim = 1, len(shape)
+    strides = [0] * ndim
+    for i in reversed(range(ndim)):
+        strides[i] = val
+        val *= shape[i]
+    return tuple(strides)
+
+
+def matmul_generic(
+    a: ArrayT, b: ArrayT,
+    batch: int, m: int, n: int, k: int,
+    a_stride: int, a_trans: bool,
+    b_stride: int, b_trans: bool
+) -> ArrayT:
+    """
+    Compute a batch of matrix products by gathering the operands within a
+    symbolic loop over the inner dimension. The parameters have the same
+    meaning as those of :py:func:`drjit.detail.matmul`.
+
+    This fallback handles all backends and types, but it is slow compared to
+    the blocked CPU implementation.
+    """
+    Value = type(a)
+    Index = dr.uint32_array_t(Value)
+
+    index = dr.arange(Index, batch * m * n)
+    bi = index // (m * n)
+    index -= bi * (m * n)
+    i = index // n
+    j = index - i * n
+
+    a_offset = bi * a_stride + (i if a_trans else i * k)
+    b_offset = bi * b_stride + (j * k if b_trans else j)
+    a_step, b_step = (m if a_trans else 1), (1 if b_trans else n)
+
+    return dr.while_loop(
+        label="Matrix multiplication",
+        labels=("p", "a_offset", "b_offset", "a", "b", "accum"),
+        state=(Index(0), a_offset, b_offset, a, b,
+               dr.zeros(Value, batch * m * n)),
+        cond=lambda p, *args: p < Index(k),
+        body=lambda p, a_offset, b_offset, a, b, accum: (
+            p + 1,
+            a_offset + a_step,
+            b_offset + b_step,
+            a, b,
+            dr.fma(dr.gather(Value, a, a_offset),
+                   dr.gather(Value, b, b_offset), accum)
+        ),
+        max_iterations=-1
+    )[5]
+
+
+def matmul_blocked(
+    a: ArrayT, b: ArrayT,
+    batch: int, m: int, n: int, k: int,
+    a_stride: int, a_trans: bool,
+    b_stride: int, b_trans: bool
+) -> ArrayT:
+    """
+    Compute a batch of matrix products using the blocked CPU implementation.
+    Operands that are broadcast over the batch (``stride == 0``) are
+    supported. This function does not track derivatives.
+    """
+    tp = type(a)
+    a, b = dr.detach(a, False), dr.detach(b, False)
+
+    # Turn e.g. zero-valued literal gradients into full-size arrays
+    a_size = a_stride * (batch - 1) + m * k
+    b_size = b_stride * (batch - 1) + k * n
+    if dr.width(a) != a_size:
+        a = a + dr.zeros(type(a), a_size)
+    if dr.width(b) != b_size:
+        b = b + dr.zeros(type(b), b_size)
+
+    return tp(dr.detail.matmul(batch, m, n, k, a, a_stride, a_trans,
+                               b, b_stride, b_trans))
+
+
+def _sum_batch(value: ArrayT, batch: int, size: int) -> ArrayT:
+    """Sum ``batch`` consecutive blocks of ``size`` entries"""
+    if batch == 1:
+        return value
+    Tensor = dr.tensor_t(type(value))
+    return dr.sum(Tensor(value, (batch, size)), axis=0).array
+
+
+class MatmulOp(dr.CustomOp):
+    """
+    Differentiable wrapper around :py:func:`matmul_blocked`. The derivatives
+    are themselves matrix products that reuse the blocked implementation.
+    """
+    def eval(self, a, b, batch, m, n, k, a_stride, a_trans, b_stride, b_trans):
+        self.a, self.b = dr.detach(a), dr.detach(b)
+        self.args = (batch, m, n, k, a_stride, a_trans, b_stride, b_trans)
+        return matmul_blocked(self.a, self.b, *self.args)
+
+    def forward(self):
+        batch, m, n, k, a_stride, a_trans, b_stride, b_trans = self.args
+        grad_a, grad_b = self.grad_in('a'), self.grad_in('b')
+
+        self.set_grad_out(
+            matmul_blocked(grad_a, self.b, batch, m, n, k, a_stride,
+                           a_trans, b_stride, b_trans) +
+            matmul_blocked(self.a, grad_b, batch, m, n, k, a_stride,
+                           a_trans, b_stride, b_trans))
+
+    def backward(self):
+        batch, m, n, k, a_stride, a_trans, b_stride, b_trans = self.args
+        a_batch = 1 if a_stride == 0 else batch
+        b_batch = 1 if b_stride == 0 else batch
+        grad_out = self.grad_out()
+
+        # Derivative of op(A), i.e. grad_out @ op(B)^T (transposed if needed)
+        if not a_trans:
+            grad_a = matmul_blocked(grad_out, self.b, batch, m, k, n,
+                                    m * n, False, b_stride, not b_trans)
+        else:
+            grad_a = matmul_blocked(self.b, grad_out, batch, k, m, n,
+                                    b_stride, b_trans, m * n, True)
+
+        # Derivative of op(B), i.e. op(A)^T @ grad_out (transposed if needed)
+        if not b_trans:
+            grad_b = matmul_blocked(self.a, grad_out, batch, k, n, m,
+                                    a_stride, not a_trans, m * n, False)
+        else:
+            grad_b = matmul_blocked(grad_out, self.a, batch, n, k, m,
+                                    m * n, True, a_stride, a_trans)
+
+        # Accumulate over the batch when an operand was broadcast
+        if a_batch != batch:
+            grad_a = _sum_batch(grad_a, batch, m * k)
+        if b_batch != batch:
+            grad_b = _sum_batch(grad_b, batch, k * n)
+
+        self.set_grad_in('a', grad_a)
+        self.set_grad_in('b', grad_b)
+
+
+def _operand(value, batch_shape: Tuple[int, ...], rows: int, cols: int):
+    """
+    Prepare a matrix operand of shape ``(..., rows, cols)`` for a batched
+    product over ``batch_shape``. Returns the flat storage, the distance
+    between consecutive matrices, and whether the matrices are stored in
+    transposed (column-major) order.
+    """
+    shape = value.shape
+    batch = dr.prod(batch_shape)
+    own_batch = dr.prod(shape[:-2])
+    strides, offset = dr.detail.tensor_layout(value)
+    strides = tuple(strides)
+
+    # Matrices that were transposed, e.g. via drjit.moveaxis(), can be
+    # processed without reordering their entries
+    trans = offset == 0 and rows > 1 and cols > 1 and \
+        strides[-2:] == (1, rows) and \
+        strides[:-2] == _compute_strides(shape[:-2] + (rows * cols,))[:-1]
+
+    if trans:
+        shape_t = shape[:-2] + (cols, rows)
+        value = dr.detail.tensor_view(value, shape_t,
+                                      _compute_strides(shape_t), 0)
+
+    if own_batch == batch or own_batch == 1:
+        stride = rows * cols if own_batch == batch and batch > 1 else 0
+        return value.array, stride, trans
+
+    # General broadcasting: create a view with zero-valued strides along
+    # the broadcast axes, which is gathered into a contiguous array
+    strides, offset = dr.detail.tensor_layout(value)
+    ndim = len(batch_shape)
+    pad = ndim - (len(shape) - 2)
+    shape_v = (1,) * pad + tuple(value.shape)
+    strides_v = (0,) * pad + tuple(strides)
+    strides_v = tuple(0 if shape_v[i] == 1 and i < ndim else strides_v[i]
+                      for i in range(len(shape_v)))
+    shape_v = tuple(batch_shape) + shape_v[ndim:]
+    value = dr.detail.tensor_view(value, shape_v, strides_v, offset)
+    return value.array, rows * cols, trans
+
+
+def tensor_matmul(a: ArrayT, b: ArrayT) -> ArrayT:
+    """
+    Multiply two tensors following the broadcasting conventions of
+    ``numpy.matmul()``. This function is an implementation detail of
+    :py:func:`drjit.matmul()`, which calls it to handle tensor arguments.
+
+    1D operands are promoted to matrices by prepending (``a``) or appending
+    (``b``) an axis of size 1, which is removed from the result. Leading
+    batch dimensions are broadcast against each other.
+
+    Single and double precision products on the CPU (LLVM and scalar
+    backends) are evaluated using a cache-blocked kernel that is
+    differentiable via a custom AD operation. Other cases use a loop that
+    gathers the operands and accumulates the products.
+    """
+    Tensor = type(a)
+    if type(b) is not Tensor:
+        raise TypeError("both operands must be tensors of the same type.")
+
+    shape_a, shape_b = a.shape, b.shape
+    if len(shape_a) == 0 or len(shape_b) == 0:
+        raise RuntimeError("operands must have at least one dimension.")
+
+    vec_a, vec_b = len(shape_a) == 1, len(shape_b) == 1
+    if vec_a:
+        a = dr.reshape(Tensor, a, (1, shape_a[0]))
+    if vec_b:
+        b = dr.reshape(Tensor, b, (shape_b[0], 1))
+
+    shape_a, shape_b = a.shape, b.shape
+    m, k, k2, n = shape_a[-2], shape_a[-1], shape_b[-2], shape_b[-1]
+
+    if k != k2:
+        raise RuntimeError(
+            f"incompatible shapes {tuple(shape_a)} and {tuple(shape_b)}: "
+            f"the inner dimensions ({k} and {k2}) do not match.")
+
+    # Broadcast the batch dimensions
+    batch_a, batch_b = shape_a[:-2], shape_b[:-2]
+    ndim = max(len(batch_a), len(batch_b))
+    batch_a = (1,) * (ndim - len(batch_a)) + tuple(batch_a)
+    batch_b = (1,) * (ndim - len(batch_b)) + tuple(batch_b)
+    batch_shape = []
+    for sa, sb in zip(batch_a, batch_b):
+        if sa != sb and sa != 1 and sb != 1:
+            raise RuntimeError(
+                f"incompatible shapes {tuple(shape_a)} and {tuple(shape_b)}: "
+                "the batch dimensions cannot be broadcast.")
+        batch_shape.append(sb if sa == 1 else sa)
+    batch_shape = tuple(batch_shape)
+    batch = dr.prod(batch_shape)
+
+    a_arr, a_stride, a_trans = _operand(a, batch_shape, m, k)
+    b_arr, b_stride, b_trans = _operand(b, batch_shape, k, n)
+
+    # A batch of matrices multiplied by a single matrix is a single product
+    m_out = m
+    if batch > 1 and b_stride == 0 and a_stride == m * k and not a_trans:
+        m, batch, a_stride = m * batch, 1, 0
+
+    Value = type(a_arr)
+    blocked = dr.backend_v(Value) in (dr.JitBackend.LLVM, dr.JitBackend.Invalid) and \
+        dr.type_v(Value) in (dr.VarType.Float32, dr.VarType.Float64) and \
+        not dr.flag(dr.JitFlag.SymbolicScope) and \
+        not dr.flag(dr.JitFlag.FreezingScope) and \
+        not dr.detail.any_symbolic((a_arr, b_arr))
+
+    args = (batch, m, n, k, a_stride, a_trans, b_stride, b_trans)
+    if not blocked:
+        result = matmul_generic(a_arr, b_arr, *args)
+    elif dr.grad_enabled((a_arr, b_arr)):
+        result = dr.custom(MatmulOp, a=a_arr, b=b_arr, batch=batch, m=m, n=n,
+                           k=k, a_stride=a_stride, a_trans=a_trans,
+                           b_stride=b_stride, b_trans=b_trans)
+    else:
+        result = matmul_blocked(a_arr, b_arr, *args)
+
+    out_shape = list(batch_shape)
+    if not vec_a:
+        out_shape.append(m_out)
+    if not vec_b:
+        out_shape.append(n)
+
+    return Tensor(result, tuple(out_shape))
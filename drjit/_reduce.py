@@ -58,6 +58,77 @@ def reduce_recursive(
         )[3]
 
 
+def tiled_transpose(
+    value: ArrayT,
+    shape: Tuple[int, ...],
+    perm: Tuple[int, ...],
+    tile: int = 32
+) -> ArrayT:
+    """
+    Reorder the entries of the flat array ``value`` representing a C-style
+    tensor of shape ``shape`` so that the axes appear in the order given by
+    ``perm``. The function returns a flat array with the entries of the
+    transposed tensor.
+
+    A naive transpose gathers the input in the order of the output, which
+    reads one cache line per entry when the innermost axes of the input and
+    output differ. This function instead visits the input in ``tile x tile``
+    blocks spanning these two axes, so that consecutive lanes read adjacent
+    input entries, and the scattered outputs of a block stay in the cache.
+    """
+    Index = dr.uint32_array_t(type(value))
+    ndim = len(shape)
+    in_strides = _compute_strides(shape)
+    out_strides_p = _compute_strides(tuple(shape[i] for i in perm))
+    out_strides = [0] * ndim
+    for i, p in enumerate(perm):
+        out_strides[p] = out_strides_p[i]
+
+    a, b = perm[-1], ndim - 1
+    if a == b:
+        # The innermost axis is unchanged, gather contiguous rows
+        index = dr.arange(Index, dr.prod(shape))
+        offset = dr.zeros(Index, dr.prod(shape))
+        for i, p in enumerate(perm):
+            pos = index // out_strides_p[i]
+            offset = dr.fma(pos, in_strides[p], offset)
+            index -= pos * out_strides_p[i]
+        return dr.gather(type(value), value, offset)
+
+    # Decompose the lane index into the remaining axes (in output order), the
+    # tile indices along axes 'a' and 'b', and the position within the tile
+    tile_a, tile_b = min(tile, shape[a]), min(tile, shape[b])
+    tiles_a = (shape[a] + tile_a - 1) // tile_a
+    tiles_b = (shape[b] + tile_b - 1) // tile_b
+    dims = [(p, shape[p]) for p in perm if p != a and p != b]
+    dims += [(a, tiles_a), (b, tiles_b), (a, tile_a), (b, tile_b)]
+    scale = [1] * (ndim - 2) + [tile_a, tile_b, 1, 1]
+
+    size = dr.prod(tuple(d[1] for d in dims))
+    index = dr.arange(Index, size)
+    pos = [Index(0)] * ndim
+    for (axis, extent), scale_i in zip(reversed(dims), reversed(scale)):
+        tmp = index // extent
+        pos[axis] = dr.fma(index - tmp * extent, scale_i, pos[axis])
+        index = tmp
+
+    in_offset = dr.zeros(Index, size)
+    out_offset = dr.zeros(Index, size)
+    for i in range(ndim):
+        in_offset = dr.fma(pos[i], in_strides[i], in_offset)
+        out_offset = dr.fma(pos[i], out_strides[i], out_offset)
+
+    # Mask lanes of partial tiles at the boundary
+    active = True
+    if shape[a] % tile_a != 0 or shape[b] % tile_b != 0:
+        active = (pos[a] < shape[a]) & (pos[b] < shape[b])
+
+    result = dr.empty(type(value), dr.prod(shape))
+    dr.scatter(result, dr.gather(type(value), value, in_offset, active),
+               out_offset, active, mode=dr.ReduceMode.Permute)
+    return result
+
+
 def tensor_reduce(
     op: dr.ReduceOp,
     value: ArrayT,
@@ -83,7 +154,16 @@ def tensor_reduce(
        This strategy requires evaluating the input array, which is potentially
        costly in terms of CPU/GPU memory.
 
-    3. ``mode="symbolic"``: Issue atomic scatter-reductions to populate the
+    3. ``mode="evaluated"``, transposed: When the reduced axes are not
+       trailing, and the gather-based strategy would either produce too few
+       outputs to keep the device busy, or read memory incoherently (when the
+       innermost output axis is not contiguous in the input), reorder the
+       input via a cache-tiled transpose so that the reduced axes become
+       contiguous, and then call :py:func:`drjit.block_reduce`. This requires
+       storage for a copy of the input tensor. The choice between this
+       strategy and strategy 2 is made automatically.
+
+    4. ``mode="symbolic"``: Issue atomic scatter-reductions to populate the
        output tensor. Since explicit evaluation and storage are not required,
        this mode is preferable when the input tensor is very large (e.g., when
        it would not fit into memory).
@@ -162,12 +242,13 @@ def tensor_reduce(
             'tensor_reduce(): \'mode\' must be "symbolic", "evaluated", or None.'
         )
 
+    can_block_reduce = dr.backend_v(in_array) is not dr.JitBackend.CUDA or \
+        block_size & (block_size - 1) == 0
+
     if in_size == out_size:
         # No-op
         out_array = in_array
-    elif len(block_strides) == 1 and block_strides[0] == 1 and \
-        (dr.backend_v(in_array) is not dr.JitBackend.CUDA or
-         block_size & (block_size - 1) == 0):
+    elif len(block_strides) == 1 and block_strides[0] == 1 and can_block_reduce:
         # The requested reduction is also doable via dr.block_reduce(), which
         # is going to be more optimized than the other strategies in this file.
         out_array = dr.block_reduce(op, in_array, block_size, mode)
@@ -175,6 +256,13 @@ def tensor_reduce(
         # The requested reduction is also doable via dr.reduce() in 1D, which
         # is going to be more optimized than the other strategies in this file.
         out_array = dr.reduce(op, in_array, 0, mode)
+    elif not symbolic and can_block_reduce and in_size > 0 and \
+        (out_strides_i[-1] != 1 or (out_size < 16384 and block_size > 64)):
+        # Move the reduced axes to the end and reduce contiguous blocks
+        perm = tuple(i for i in range(len(in_shape)) if i not in axis) + \
+            tuple(i for i in range(len(in_shape)) if i in axis)
+        out_array = dr.block_reduce(
+            op, tiled_transpose(in_array, in_shape, perm), block_size, mode)
     elif symbolic:
         index = dr.arange(Index, in_size)
         offset = dr.zeros(Index, in_size)
@@ -464,8 +464,21 @@ class HashGridEncoding(HashEncoding):
         init_scale: The parameters of the hashgrid are initialized with a uniform
             distribution, ranging from -init_scale to +init_scale.
         rng: Random number generator, used to initialize the parameters.
+        fused: If this value is ``True``, the encoding is evaluated by a native
+            operation that visits all levels and voxel corners at once and
+            tracks them using a single node in the AD graph. Its reverse-mode
+            derivative recomputes the lookups and scatters the gradients into
+            the parameters one level at a time. The fused operation does not
+            propagate gradients to the input positions. The encoding
+            therefore falls back to the regular implementation when the
+            positions are attached to the AD graph.
     """
 
+    # Whether to evaluate the encoding using the fused native operation
+    _fused: bool
+    # (scale, resolution, offset, size) of each level, used by the fused operation
+    _levels: List[Tuple[float, int, int, int]]
+
     @overload
     def __init__(
         self,
@@ -483,10 +496,25 @@ class HashGridEncoding(HashEncoding):
         smooth_weight_lambda: float = 1.0,
         init_scale: float = 1e-4,
         rng: drjit.random.Generator | None = None,
+        fused: bool = True,
     ) -> None: ...
 
-    def __init__(self, *args, **kwargs) -> None:
+    def __init__(self, *args, fused: bool = True, **kwargs) -> None:
         super().__init__(*args, **kwargs)
+        self._fused = fused
+        self._levels = []
+        for level_i in range(self.n_levels):
+            scale = float(self._level_scale(level_i))
+            offset = self._level_offsets[level_i]
+            size = self._level_offsets[level_i + 1] - offset
+            self._levels.append((scale, self._resolution(scale), offset, size))
+
+    @property
+    def fused(self) -> bool:
+        """
+        Whether the encoding is evaluated using the fused native operation.
+        """
+        return self._fused
 
     def __call__(
         self, p: Iterable[drjit.ArrayBase], active: bool | drjit.ArrayBase = True
@@ -502,6 +530,20 @@ class HashGridEncoding(HashEncoding):
             f" but got {len(p)}."
         )
 
+        if self._fused and dr.is_jit_v(self.dtype) and not dr.grad_enabled(p):
+            p_offset: float = (
+                0.5 if not self.align_corners or self.torchngp_compat else 0.0
+            )
+            values = dr.detail.hashgrid_encode(
+                self.data,
+                [p[d] for d in range(self.dimension)],
+                self.n_features_per_level,
+                self._levels,
+                p_offset,
+                dr.mask_t(self.StorageFloat)(active),
+            )
+            return self.StorageFloatXf(*values)
+
         # Stores the pattern of offsets used to index the 2**n corners of a voxel
         grid_offsets = [
             self.ArrayXu([(i >> j) & 1 for j in range(self.dimension)])
@@ -565,7 +607,8 @@ class HashGridEncoding(HashEncoding):
             f"    align_corners={self.align_corners},\n"
             f"    torchngp_compat={self.torchngp_compat},\n"
             f"    smooth_weight_gradients={self.smooth_weight_gradients},\n"
-            f"    smooth_weight_lambda={self.smooth_weight_lambda}\n"
+            f"    smooth_weight_lambda={self.smooth_weight_lambda},\n"
+            f"    fused={self.fused}\n"
             ")"
         )
 
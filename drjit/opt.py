@@ -11,6 +11,7 @@ from typing import (
     Tuple,
     Dict,
     TypeVar,
+    List,
 )
 import sys
 
@@ -123,6 +124,21 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
     # Promote half-precision variables to use single precision internal storage?
     promote_fp16: bool
 
+    # Update flat parameters of the same type using a single arena?
+    fused: bool
+
+    # Store optimizer state (e.g., moment accumulators) in half precision?
+    state_fp16: bool
+
+    # Round updates of half precision parameters and state stochastically?
+    stochastic_rounding: bool
+
+    # Random number generator used for stochastic rounding
+    rng: Optional[dr.random.Generator]
+
+    # Fused mode: maps the flat parameter type to its arena
+    arenas: Dict[Type[dr.ArrayBase], "_Arena"]
+
     # Maps the parameter name to a tuple containing
     # - the current parameter value
     # - whether the parameter was promoted to single precision
@@ -133,6 +149,7 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
     DRJIT_STRUCT = {
         "lr": LearningRate,
         "state": dict,
+        "rng": Optional[dr.random.Generator],
     }
 
     def __init__(
@@ -142,6 +159,9 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
         *,
         mask_updates: bool = False,
         promote_fp16: bool = True,
+        fused: bool = False,
+        state_fp16: bool = False,
+        stochastic_rounding: bool = False,
     ):
         """
         Create an empty Optimizer object with the learning rate ``lr`` and initial
@@ -183,6 +203,49 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
                 prevent issues, where rounding inteferes with the optimization.
                 Accessing the current state via ``optimizer["parameter_name"]``
                 will cast back to half precision.
+
+            fused (bool):
+                If set to ``True``, the optimizer concatenates the values,
+                gradients, and internal state (e.g., moment accumulators) of
+                all flat parameters (1D arrays and tensors) of the same type
+                into a contiguous *arena*. :py:func:`step()` then updates each
+                arena using a single vectorized computation with
+                per-parameter learning rates, instead of generating separate
+                code for each parameter. This reduces tracing overheads and
+                kernel size when an optimization involves many parameters.
+
+                The optimizer continues to expose each parameter (and its
+                internal state) separately. These are now views that
+                reference the arena, which Dr.Jit fuses into subsequent
+                computation. Nested arrays are updated as before.
+
+                In fused mode, :py:func:`step()` always evaluates the arena,
+                even when ``eval=False`` is specified. Within frozen functions
+                (:py:func:`drjit.freeze`), :py:func:`step()` falls back to
+                updating each parameter separately, since the arenas are not
+                part of the optimizer state traversed by the frozen function.
+
+            state_fp16 (bool):
+                If set to ``True``, the optimizer stores its internal state
+                (e.g., the moment accumulators of :py:class:`Adam`) in half
+                precision, which halves its memory usage and bandwidth
+                compared to single precision parameters. The update itself
+                is still computed in single precision. Second moments are
+                stored as their square root, which keeps them within the
+                range of half precision numbers. This option is best combined
+                with ``stochastic_rounding=True``.
+
+            stochastic_rounding (bool):
+                If set to ``True``, the optimizer rounds updated half precision
+                values (parameters that were not promoted, see
+                ``promote_fp16``, and state stored via ``state_fp16``)
+                *stochastically*: the probability of rounding up is
+                proportional to the distance from the next smaller
+                representable value. Rounding is then unbiased on average,
+                and small updates that would otherwise be lost to rounding
+                still contribute. The update is computed in single precision.
+                The random numbers are drawn from the generator stored in
+                the ``rng`` attribute.
         """
 
         if isinstance(lr, float) and lr < 0:
@@ -191,6 +254,11 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
         self.lr = lr
         self.mask_updates = mask_updates
         self.promote_fp16 = promote_fp16
+        self.fused = fused
+        self.arenas = {}
+        self.state_fp16 = state_fp16
+        self.stochastic_rounding = stochastic_rounding
+        self.rng = dr.rng() if stochastic_rounding else None
         self.state = {}
 
         if params:
@@ -437,12 +505,36 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
         """
 
         with dr.profile_range('Optimizer.step()'):
-            cache = _LRCache()
+            cache = _LRCache(active=active)
+
+            # Fused mode: flat parameters grouped by type
+            groups: Dict[Type[dr.ArrayBase], List[str]] = {}
+
+            # The arenas aren't traversed by frozen functions, which would
+            # replay the step with stale arena buffers. Update each parameter
+            # separately in this case. The next step outside of the frozen
+            # function repacks the arenas, since the views were replaced.
+            fused = self.fused and not dr.flag(dr.JitFlag.FreezingScope)
 
             for key, (value, promoted, lr, extra) in self.state.items():
+                # Fused mode: defer flat parameters to the arena of their type
+                if fused:
+                    flat_tp = type(value.array)
+                    if dr.depth_v(flat_tp) == 1:
+                        groups.setdefault(flat_tp, []).append(key)
+                        continue
+
                 # Fetch the parameter gradient and convert special array types
                 # (e.g. complex numbers) into ones with element-wise semantics
                 grad = value.grad.array
+                value_flat = dr.detach(value).array
+
+                # Optional: compute the update of half precision parameters
+                # in single precision and round the result stochastically
+                half = self._is_half(value_flat)
+                if half:
+                    grad = dr.float32_array_t(grad)(grad)
+
                 if grad_scale is not None:
                     grad *= grad_scale
 
@@ -450,8 +542,16 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
                 lr_v = lr if lr is not None else self.lr
 
                 # Optimizer-specific step
-                value_flat = dr.detach(value).array
-                new_value, new_extra = self._step(cache, value_flat, grad, lr_v, extra)
+                new_value, new_extra = self._step(
+                    cache,
+                    dr.float32_array_t(value_flat)(value_flat) if half else value_flat,
+                    grad,
+                    lr_v,
+                    extra
+                )
+
+                if half:
+                    new_value = self._round(new_value, type(value_flat))
 
                 # Optional: mask updates to components with zero-valued gradients
                 mask = False
@@ -481,10 +581,82 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
                 dr.schedule(new_state)
                 self.state[key] = new_state
 
-            # Submit a kernel containing queued parameter updates
-            if eval:
+            if groups:
+                self._step_fused(groups, grad_scale, active)
+            elif eval:
+                # Submit a kernel containing queued parameter updates
                 dr.eval()
 
+    def _step_fused(
+        self,
+        groups: Dict[Type[dr.ArrayBase], List[str]],
+        grad_scale: Optional[LearningRate],
+        active: Optional[dr.ArrayBase],
+        /,
+    ) -> None:
+        """
+        Implementation detail of :py:func:`step()` in fused mode: update
+        each group of flat parameters using the arena of their type.
+        """
+
+        arenas: Dict[Type[dr.ArrayBase], _Arena] = {}
+        updates = []
+
+        for tp, keys in groups.items():
+            # Reuse the arena if the set of parameters didn't change
+            arena = self.arenas.get(tp, None)
+            if arena is None or not arena.compatible(keys, self.state):
+                arena = _Arena(tp, keys, self.state)
+            arena.pack(self.state)
+            arenas[tp] = arena
+
+            value, extra = arena.value, arena.extra
+            grad = arena.grad(self.state)
+
+            half = self._is_half(value)
+            if half:
+                grad = dr.float32_array_t(grad)(grad)
+
+            if grad_scale is not None:
+                grad *= grad_scale
+
+            # Optimizer-specific step, with per-parameter scale factors
+            # expanded to the arena by the learning rate cache
+            cache = _LRCache(arena.segment, active)
+            new_value, new_extra = self._step(
+                cache,
+                dr.float32_array_t(value)(value) if half else value,
+                grad,
+                arena.learning_rate(self),
+                extra
+            )
+
+            if half:
+                new_value = self._round(new_value, type(value))
+
+            mask = False
+            if self.mask_updates:
+                mask |= grad == 0
+
+            if active is not None:
+                mask |= ~active
+
+            if mask is not False:
+                new_value = dr.select(mask, value, new_value)
+                new_extra = self._select(mask, extra, new_extra)
+
+            dr.schedule(new_value, new_extra)
+            updates.append((arena, new_value, new_extra))
+
+        # Submit a kernel containing queued parameter updates. The arenas
+        # must be evaluated before the per-parameter views can reference them.
+        dr.eval()
+
+        for arena, new_value, new_extra in updates:
+            arena.unpack(self.state, new_value, new_extra)
+
+        self.arenas = arenas
+
     # To be provided by subclasses
     def _step(
         self,
@@ -512,6 +684,89 @@ class Optimizer(Generic[Extra], MutableMapping[str, dr.ArrayBase]):
     def _filter(self, params: Mapping[str, dr.ArrayBase], /) -> Mapping[str, dr.ArrayBase]:
         return params
 
+    # Is 'value' a half precision array whose updates should be rounded stochastically?
+    def _is_half(self, value: dr.ArrayBase, /) -> bool:
+        return self.stochastic_rounding and dr.type_v(value) == dr.VarType.Float16
+
+    # Type of optimizer state arrays associated with a parameter of type 'tp'
+    def _state_t(self, tp: Type[dr.ArrayBase], /) -> Type[dr.ArrayBase]:
+        return dr.float16_array_t(tp) if self.state_fp16 else tp
+
+    # Is 'value' a half precision optimizer state array that is updated in
+    # single precision? This is the case with 'state_fp16', and for the
+    # state of half precision parameters with 'stochastic_rounding'.
+    def _is_half_state(self, value: dr.ArrayBase, /) -> bool:
+        return (self.state_fp16 or self.stochastic_rounding) and \
+            dr.type_v(value) == dr.VarType.Float16
+
+    # Fetch an optimizer state array for use in a single precision computation
+    def _load(self, value: dr.ArrayBase, second_moment: bool = False, /) -> dr.ArrayBase:
+        if not self._is_half_state(value):
+            return value
+        value = dr.float32_array_t(value)(value)
+
+        # Second moments are stored as their square root (see _store())
+        return dr.square(value) if second_moment else value
+
+    # Convert an updated optimizer state array back into the format of 'prev'
+    def _store(self, value: dr.ArrayBase, prev: dr.ArrayBase,
+               second_moment: bool = False, /) -> dr.ArrayBase:
+        if not self._is_half_state(prev):
+            return value
+
+        # Squared gradients frequently underflow in half precision.
+        # Their square root has the same range as the gradient.
+        if second_moment:
+            value = dr.sqrt(value)
+
+        return self._round(value, type(prev))
+
+    # Round a single precision array to the half precision type 'tp'
+    def _round(self, value: dr.ArrayBase, tp: Type[dr.ArrayT], /) -> dr.ArrayT:
+        if not self.stochastic_rounding:
+            return tp(value)
+
+        assert self.rng is not None
+        sample = self.rng.random(type(value), dr.width(value))
+        return _stochastic_round(value, tp, sample)
+
+
+def _stochastic_round(value: dr.ArrayBase, tp: Type[dr.ArrayT],
+                      sample: dr.ArrayBase) -> dr.ArrayT:
+    """
+    Implementation detail: round the single precision array ``value`` to the
+    half precision type ``tp``.
+
+    The result is one of the two representable values bracketing ``value``.
+    The probability of choosing either of them is proportional to
+    the distance from the other one, so that rounding is unbiased on average.
+    ``sample`` contains uniformly distributed variates on the interval
+    :math:`[0, 1)`.
+    """
+
+    Float = type(value)
+    UInt = dr.uint32_array_t(Float)
+
+    # Round to the nearest representable value
+    near = tp(value)
+    near_f = Float(near)
+    err = value - near_f
+
+    # Power of two below |near|, based on its exponent bits
+    exp = dr.reinterpret_array(Float, dr.reinterpret_array(UInt, near_f) & 0x7f800000)
+
+    # Distance to the next representable value in the direction of 'err'.
+    # It is 2^-10 times this power of two, or 2^-24 in the subnormal range.
+    # Moving towards zero from a power of two, the distance halves.
+    ulp = dr.maximum(exp * 2.0**-10, 2.0**-24)
+    towards_zero = (err < 0) ^ (near_f < 0)
+    ulp = dr.select(towards_zero & (dr.abs(near_f) == exp) & (exp > 2.0**-14),
+                    ulp * 0.5, ulp)
+
+    # Move to the other value with probability |err| / ulp
+    other = tp(near_f + dr.copysign(ulp, err))
+    return dr.select(sample * ulp < dr.abs(err), other, near)
+
 class _LRCache(Dict[Tuple[Type[dr.ArrayBase], float], dr.ArrayBase]):
     """
     Implementation detail: learning rate cache.
@@ -527,8 +782,21 @@ class _LRCache(Dict[Tuple[Type[dr.ArrayBase], float], dr.ArrayBase]):
     It is nice to reuse the opaque array once it has been created.
 
     The _LRCache class is a simple internal cache to enable this reuse.
+
+    In fused mode, a scale factor may be an array with one entry per
+    parameter of an arena. The cache then expands it to the size of the
+    arena using the arena's segment index.
+
+    The cache also provides the ``active`` mask of the current step to
+    optimizers that update their state in place (e.g., lazy :py:class:`Adam`).
     """
 
+    def __init__(self, segment: Optional[dr.ArrayBase] = None,
+                 active: Optional[dr.ArrayBase] = None):
+        super().__init__()
+        self.segment = segment
+        self.active = active
+
     def product(
         self, tp: Type[dr.ArrayT], *args: Union[float, dr.ArrayBase]
     ) -> dr.ArrayT:
@@ -562,9 +830,141 @@ class _LRCache(Dict[Tuple[Type[dr.ArrayBase], float], dr.ArrayBase]):
                     f"Scaled step size has type {type(scale_o)}, expected {tp}"
                 )
 
+            # Fused mode: expand per-parameter scale factors
+            if self.segment is not None and dr.width(result) > 1:
+                result = dr.gather(tp, result, self.segment)
+
         return result  # type: ignore
 
 
+def _map_extra(func, *args):
+    """
+    Implementation detail of fused mode: apply ``func`` to the corresponding
+    arrays of one or more optimizer-dependent state values, which may be
+    arrays, ``None``, or tuples thereof.
+    """
+    arg = args[0]
+    if arg is None:
+        return None
+    elif isinstance(arg, tuple):
+        return tuple(_map_extra(func, *a) for a in zip(*args))
+    else:
+        return func(*args)
+
+
+class _Arena:
+    """
+    Implementation detail: flat storage of parameters in fused mode.
+
+    An arena concatenates the values and optimizer-dependent state (e.g.,
+    moment accumulators) of all flat parameters of an optimizer that have the
+    same type, so that :py:func:`Optimizer.step()` can update them at once.
+
+    Each array of the optimizer-dependent state either stores one entry per
+    parameter component (e.g., Adam's moments), or one entry per parameter
+    (e.g., Adam's iteration count). The arena concatenates both kinds, and
+    ``segment`` maps each component to the index of its parameter.
+
+    Following a step, the ``Optimizer.state`` entries are *views* that gather
+    from the arena. The arena detects when one of them was replaced (e.g., via
+    :py:func:`Optimizer.__setitem__()` or :py:func:`Optimizer.reset()`)
+    and repacks its contents from the per-parameter state when needed.
+    """
+
+    def __init__(self, tp: Type[dr.ArrayBase], keys: List[str],
+                 state: Mapping[str, Tuple[dr.ArrayBase, bool, Optional[LearningRate], Any]]):
+        self.tp = tp
+        self.keys = keys
+        self.sizes = [dr.width(state[k][0].array) for k in keys]
+        self.offsets = []
+        self.size = 0
+        for size in self.sizes:
+            self.offsets.append(self.size)
+            self.size += size
+
+        self.value: Optional[dr.ArrayBase] = None
+        self.extra: Any = None
+        self.views: List[Tuple[dr.ArrayBase, Any]] = []
+        self.lr_cache: Optional[Tuple[Tuple[float, ...], dr.ArrayBase]] = None
+
+        # Map each component to the index of its parameter
+        self.segment: Optional[dr.ArrayBase] = None
+        if len(keys) > 1:
+            Index = dr.uint32_array_t(tp)
+            marks = dr.zeros(Index, self.size)
+            dr.scatter(marks, Index(1), Index(self.offsets[1:]))
+            self.segment = dr.cumsum(marks)
+
+    def compatible(self, keys: List[str], state) -> bool:
+        """Does the arena have the right layout for the parameters ``keys``?"""
+        return keys == self.keys and all(
+            dr.width(state[k][0].array) == size
+            for k, size in zip(keys, self.sizes)
+        )
+
+    def pack(self, state) -> None:
+        """Copy per-parameter values/state that changed into the arena"""
+        entries = [state[k] for k in self.keys]
+        views = self.views
+
+        if not views or any(e[0] is not v[0] for e, v in zip(entries, views)):
+            self.value = dr.concat([dr.detach(e[0]).array for e in entries])
+
+        if not views or any(e[3] is not v[1] for e, v in zip(entries, views)):
+            self.extra = _map_extra(lambda *a: dr.concat(a), *[e[3] for e in entries])
+
+    def grad(self, state) -> dr.ArrayBase:
+        """Concatenate the gradients of all parameters"""
+        return dr.concat([state[k][0].grad.array for k in self.keys])
+
+    def learning_rate(self, opt: Optimizer) -> LearningRate:
+        """Return the learning rate, or an array of per-parameter learning rates"""
+        lrs = [state[2] if state[2] is not None else opt.lr
+               for state in (opt.state[k] for k in self.keys)]
+        first = lrs[0]
+
+        if all(lr is first for lr in lrs):
+            return first
+
+        if all(isinstance(lr, (int, float)) for lr in lrs):
+            key = tuple(lrs)
+            if all(lr == first for lr in key):
+                return first
+
+            # Only upload the table when the learning rates changed
+            if self.lr_cache is None or self.lr_cache[0] != key:
+                self.lr_cache = key, self.tp(key)
+            return self.lr_cache[1]
+
+        return dr.concat([
+            lr if isinstance(lr, dr.ArrayBase) else self.tp(lr) for lr in lrs
+        ])
+
+    def unpack(self, state, value: dr.ArrayBase, extra: Any) -> None:
+        """Adopt a new arena state and create per-parameter views of it"""
+        self.value, self.extra = value, extra
+        self.views = []
+
+        Index = dr.uint32_array_t(self.tp)
+        for i, (key, offset, size) in enumerate(zip(self.keys, self.offsets, self.sizes)):
+            param, promoted, lr, _ = state[key]
+            index = dr.arange(Index, offset, offset + size)
+
+            def view(x: dr.ArrayBase) -> dr.ArrayBase:
+                # Per-component or per-parameter array?
+                return dr.gather(type(x), x, index if dr.width(x) == self.size else Index(i))
+
+            new_value = view(value)
+            param_tp = type(param)
+            if dr.is_tensor_v(param_tp):
+                new_value = param_tp(new_value, param.shape)
+            dr.enable_grad(new_value)
+
+            new_extra = _map_extra(view, extra)
+            self.views.append((new_value, new_extra))
+            state[key] = new_value, promoted, lr, new_extra
+
+
 class SGD(Optimizer[Optional[dr.ArrayBase]]):
     """
     Implements basic *stochastic gradient descent* (SGD) with a fixed learning
@@ -618,6 +1018,9 @@ class SGD(Optimizer[Optional[dr.ArrayBase]]):
         nesterov: bool = False,
         mask_updates: bool = False,
         promote_fp16: bool = True,
+        fused: bool = False,
+        state_fp16: bool = False,
+        stochastic_rounding: bool = False,
     ):
         """
         Args:
@@ -640,6 +1043,18 @@ class SGD(Optimizer[Optional[dr.ArrayBase]]):
                 promoted half-precision variables to single precision internal storage?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
 
+            fused (bool):
+                Update flat parameters of the same type using a single arena?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            state_fp16 (bool):
+                Store the optimizer state in half precision?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            stochastic_rounding (bool):
+                Round updates of half precision values stochastically?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
             params (Mapping[str, drjit.ArrayBase] | None):
                 Optional dictionary-like object containing an initial set of
                 parameters.
@@ -658,7 +1073,10 @@ class SGD(Optimizer[Optional[dr.ArrayBase]]):
             lr,
             params,
             mask_updates=mask_updates,
-            promote_fp16=promote_fp16
+            promote_fp16=promote_fp16,
+            fused=fused,
+            state_fp16=state_fp16,
+            stochastic_rounding=stochastic_rounding
         )
 
     # To be provided by subclasses
@@ -677,11 +1095,12 @@ class SGD(Optimizer[Optional[dr.ArrayBase]]):
             step = grad
         else:
             assert v is not None
-            v_next = dr.fma(self.momentum, v, grad)
+            v_next = dr.fma(self.momentum, self._load(v), grad)
             if self.nesterov:
                 step = dr.fma(self.momentum, v_next, grad)
             else:
                 step = v_next
+            v_next = self._store(v_next, v)
 
         # Get opaque step scale
         scale = cache.product(
@@ -698,7 +1117,7 @@ class SGD(Optimizer[Optional[dr.ArrayBase]]):
         if self.momentum == 0:
             m = None
         else:
-            m = dr.opaque(tp, 0, valarr.shape)
+            m = dr.opaque(self._state_t(tp), 0, valarr.shape)
         self.state[key] = value, promoted, None, m
 
     def __repr__(self):
@@ -765,6 +1184,9 @@ class RMSProp(Optimizer[dr.ArrayBase]):
         epsilon: float = 1e-8,
         mask_updates: bool = False,
         promote_fp16: bool = True,
+        fused: bool = False,
+        state_fp16: bool = False,
+        stochastic_rounding: bool = False,
     ):
         """
         Construct a RMSProp optimizer instance.
@@ -790,6 +1212,18 @@ class RMSProp(Optimizer[dr.ArrayBase]):
                 promoted half-precision variables to single precision internal storage?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
 
+            fused (bool):
+                Update flat parameters of the same type using a single arena?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            state_fp16 (bool):
+                Store the optimizer state in half precision?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            stochastic_rounding (bool):
+                Round updates of half precision values stochastically?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
             params (Mapping[str, drjit.ArrayBase] | None):
                 Optional dictionary-like object containing an initial set of
                 parameters.
@@ -799,7 +1233,10 @@ class RMSProp(Optimizer[dr.ArrayBase]):
             lr,
             params,
             mask_updates=mask_updates,
-            promote_fp16=promote_fp16
+            promote_fp16=promote_fp16,
+            fused=fused,
+            state_fp16=state_fp16,
+            stochastic_rounding=stochastic_rounding
         )
 
         if alpha < 0 or alpha >= 1:
@@ -820,7 +1257,7 @@ class RMSProp(Optimizer[dr.ArrayBase]):
         /,
     ) -> Tuple[dr.ArrayBase, dr.ArrayBase]:
         # Update second moment EMA
-        m_t = dr.lerp(dr.square(grad), m_tp, self.alpha)
+        m_t = dr.lerp(dr.square(grad), self._load(m_tp, True), self.alpha)
 
         # Get opaque step scale
         scale = cache.product(
@@ -836,12 +1273,12 @@ class RMSProp(Optimizer[dr.ArrayBase]):
             step = grad / (dr.sqrt(m_t) + self.epsilon)
 
         # Construct new parameter value and reattach to AD graph
-        return dr.fma(step, scale, value), m_t
+        return dr.fma(step, scale, value), self._store(m_t, m_tp, True)
 
     # Implementation detail of Optimizer.reset()
     def _reset(self, key: str, value: dr.ArrayBase, promoted: bool, /) -> None:
         valarr = value.array
-        tp = type(valarr)
+        tp = self._state_t(type(valarr))
         m_t = dr.opaque(tp, 0, valarr.shape)
         self.state[key] = value, promoted, None, m_t
 
@@ -873,7 +1310,7 @@ class RMSProp(Optimizer[dr.ArrayBase]):
         )
 
 
-class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]]]):
+class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]]]):
     """
     This class implements the Adam optimizer as presented in the paper *Adam: A
     Method for Stochastic Optimization* by Kingman and Ba, ICLR 2015.
@@ -907,8 +1344,8 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
     and :math:`\\mathbf{v}_i` at :math:`i=0`.
 
     This class also implements several extensions that are turned off by default.
-    See the descriptions of the ``mask_updates``, ``uniform``, and ``amsgrad``
-    parameters below.
+    See the descriptions of the ``mask_updates``, ``uniform``, ``amsgrad``,
+    and ``lazy`` parameters below.
     """
 
     # First moment EMA weight
@@ -929,6 +1366,9 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
     # AMSGrad: use maximum of second moment EMA [Reddi et al. 2018]
     amsgrad: bool
 
+    # Lazy Adam: only update entries that received a gradient
+    lazy: bool
+
     def __init__(
         self,
         lr: LearningRate,
@@ -941,6 +1381,10 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
         promote_fp16: bool = True,
         uniform: bool = False,
         amsgrad: bool = False,
+        lazy: bool = False,
+        fused: bool = False,
+        state_fp16: bool = False,
+        stochastic_rounding: bool = False,
     ):
         """
         Construct a new Adam optimizer object. The default parameters
@@ -977,6 +1421,22 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
                 exponential moving average to normalize the gradient. This can
                 help with convergence in some cases where Adam fails.
 
+            lazy (bool):
+                If enabled, the optimizer only updates the entries of flat
+                parameters (1D arrays and tensors) that received a nonzero
+                gradient, such as the entries of a large table that were
+                accessed via :py:func:`drjit.gather()`. Finding these entries
+                still visits the entire gradient, and the updated parameter
+                is written to a copy of the parameter. The savings instead
+                come from skipping the moment updates and the associated
+                memory writes for all other entries. The optimizer records
+                the iteration of each entry's last update, and applies the
+                decay of the moment EMAs during the skipped iterations in
+                closed form. Like ``mask_updates``, this mode does not move
+                entries without a gradient based on their momentum.
+                Determining the updated entries involves a synchronization
+                step (see :py:func:`drjit.compress()`).
+
             mask_updates (bool):
                 Mask updates to zero-valued gradient components?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
@@ -985,6 +1445,18 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
                 promoted half-precision variables to single precision internal storage?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
 
+            fused (bool):
+                Update flat parameters of the same type using a single arena?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            state_fp16 (bool):
+                Store the optimizer state in half precision?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            stochastic_rounding (bool):
+                Round updates of half precision values stochastically?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
             params (Mapping[str, drjit.ArrayBase] | None):
                 Optional dictionary-like object containing an initial set of
                 parameters.
@@ -996,18 +1468,26 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
             raise RuntimeError("'beta_2' must be on the interval [0, 1)")
         if epsilon < 0:
             raise RuntimeError("'epsilon' must be >0")
+        if uniform and fused:
+            raise RuntimeError("'uniform' is not supported in fused mode")
+        if lazy and (fused or uniform):
+            raise RuntimeError("'lazy' is incompatible with 'fused' and 'uniform'")
 
         self.beta_1 = beta_1
         self.beta_2 = beta_2
         self.epsilon = epsilon
         self.uniform = uniform
         self.amsgrad = amsgrad
+        self.lazy = lazy
 
         super().__init__(
             lr,
             params,
             mask_updates=mask_updates,
-            promote_fp16=promote_fp16
+            promote_fp16=promote_fp16,
+            fused=fused,
+            state_fp16=state_fp16,
+            stochastic_rounding=stochastic_rounding
         )
 
     def _step(
@@ -1016,23 +1496,27 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
         value: dr.ArrayBase,
         grad: dr.ArrayBase,
         lr: LearningRate,
-        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]],
+        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]],
         /,
-    ) -> Tuple[dr.ArrayBase, Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]]]:
+    ) -> Tuple[dr.ArrayBase, Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]]]:
         t_p: int  # Integer time/iteration value
         m_tp: dr.ArrayBase  # First moment EMA state from previous iteration
         v_tp: dr.ArrayBase  # Second moment EMA state from previous iteration
         v_max_p: Optional[dr.ArrayBase]  # Maximum of second moment (AMSGrad)
+        last: Optional[dr.ArrayBase]  # Iteration of the last update (lazy mode)
 
         # Unpack optimizer state
-        t_p, m_tp, v_tp, v_max_p = extra
+        t_p, m_tp, v_tp, v_max_p, last = extra
+
+        if last is not None:
+            return self._step_lazy(cache, value, grad, lr, extra)
 
         # Increase the iteration count
         t = t_p + 1
 
         # Update moment EMAs
-        m_t = dr.lerp(grad, m_tp, self.beta_1)
-        v_t = dr.lerp(dr.square(grad), v_tp, self.beta_2)
+        m_t = dr.lerp(grad, self._load(m_tp), self.beta_1)
+        v_t = dr.lerp(dr.square(grad), self._load(v_tp, True), self.beta_2)
 
         # Compute the step size scale, which is a product of
         # - EMA debiasing factor
@@ -1054,7 +1538,7 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
         if self.amsgrad:
             # AMSGrad: maintain the maximum of all past squared gradients
             assert v_max_p is not None
-            v_max = dr.maximum(v_max_p, v_t)
+            v_max = dr.maximum(self._load(v_max_p, True), v_t)
             v_tm = v_max
         elif self.uniform:
             # UniformAdam: use maximum of current second moment
@@ -1068,27 +1552,131 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
         else:
             step = m_t / (dr.sqrt(v_tm) + self.epsilon)
 
-        return dr.fma(step, scale, value), (t, m_t, v_t, v_max)
+        if v_max is not None:
+            v_max = self._store(v_max, v_max_p, True)
+
+        return dr.fma(step, scale, value), (
+            t,
+            self._store(m_t, m_tp),
+            self._store(v_t, v_tp, True),
+            v_max,
+            None
+        )
+
+    # Implementation detail of Adam._step() in lazy mode
+    def _step_lazy(
+        self,
+        cache: "_LRCache",
+        value: dr.ArrayBase,
+        grad: dr.ArrayBase,
+        lr: LearningRate,
+        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]],
+        /,
+    ) -> Tuple[dr.ArrayBase, Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]]]:
+        t_p, m_tp, v_tp, v_max_p, last = extra
+        assert last is not None
+        t = t_p + 1
+
+        Base = dr.leaf_t(grad)
+        Float64 = dr.float64_array_t(Base)
+
+        # Compact the list of entries that received a gradient. The moment
+        # arrays are updated in place, hence the 'active' mask of the step
+        # must be considered here.
+        touched = grad != 0
+        if cache.active is not None:
+            touched &= cache.active
+        index = dr.compress(touched)
+
+        if dr.width(index) == 0:
+            return value, (t, m_tp, v_tp, v_max_p, last)
+
+        g = dr.gather(Base, grad, index)
+        m_p = self._load(dr.gather(type(m_tp), m_tp, index))
+        v_p = self._load(dr.gather(type(v_tp), v_tp, index), True)
+
+        # Decay the EMAs by the zero-valued gradients of skipped iterations
+        skipped = Base(t_p - dr.gather(type(last), last, index))
+        m_p *= dr.select(skipped == 0, 1, dr.power(Base(self.beta_1), skipped))
+        v_p *= dr.select(skipped == 0, 1, dr.power(Base(self.beta_2), skipped))
+
+        # Update the EMAs of the gathered entries
+        m_t = dr.lerp(g, m_p, self.beta_1)
+        v_t = dr.lerp(dr.square(g), v_p, self.beta_2)
+
+        ema_factor = Base(
+            -dr.sqrt(1 - Float64(self.beta_2) ** t) /
+                    (1 - Float64(self.beta_1) ** t)
+        )
+        scale = cache.product(
+            dr.leaf_t(grad),  # Desired type
+            lr,
+            ema_factor,
+        )
+
+        v_tm = v_t
+        if self.amsgrad:
+            # The maximum doesn't decay, skipped iterations don't affect it
+            assert v_max_p is not None
+            v_tm = dr.maximum(self._load(dr.gather(type(v_max_p), v_max_p, index), True), v_t)
+            dr.scatter(v_max_p, self._store(v_tm, v_max_p, True), index)
+
+        if self.epsilon <= 1e-6:
+            step = m_t * dr.rsqrt(v_tm + self.epsilon**2)
+        else:
+            step = m_t / (dr.sqrt(v_tm) + self.epsilon)
+
+        # Write back the updated entries. The state arrays are only referenced
+        # by the optimizer, which permits an in-place update. The parameter is
+        # also referenced by the AD graph, and its update creates a copy.
+        dr.scatter(m_tp, self._store(m_t, m_tp), index)
+        dr.scatter(v_tp, self._store(v_t, v_tp, True), index)
+        dr.scatter(last, type(last)(t), index)
+
+        new_value = type(value)(value)
+        p = dr.gather(type(value), value, index)
+        p = self._decay_lazy(cache, lr, p, skipped + 1)
+        dr.scatter(new_value, dr.fma(step, scale, p), index)
+
+        return new_value, (t, m_tp, v_tp, v_max_p, last)
+
+    # Implementation detail of Adam._step_lazy(): apply the weight decay of
+    # 'n' iterations to the gathered entries 'p' (overridden by AdamW)
+    def _decay_lazy(
+        self,
+        cache: "_LRCache",
+        lr: LearningRate,
+        p: dr.ArrayBase,
+        n: dr.ArrayBase,
+        /,
+    ) -> dr.ArrayBase:
+        return p
 
     # Implementation detail of Optimizer.reset()
     def _reset(self, key: str, value: dr.ArrayBase, promoted: bool, /) -> None:
         valarr = value.array
-        tp = type(valarr)
+        tp = self._state_t(type(valarr))
         UInt = dr.uint32_array_t(dr.leaf_t(tp))
         t = UInt(0)
         m_t = dr.opaque(tp, 0, valarr.shape)
         v_t = dr.opaque(tp, 0, valarr.shape)
         v_max = dr.opaque(tp, 0, valarr.shape) if self.amsgrad else None
-        self.state[key] = value, promoted, None, (t, m_t, v_t, v_max)
+
+        # Lazy mode: iteration of the last update of each entry
+        last = None
+        if self.lazy and dr.depth_v(tp) == 1:
+            last = dr.opaque(UInt, 0, valarr.shape)
+
+        self.state[key] = value, promoted, None, (t, m_t, v_t, v_max, last)
 
     # Blend between the old and new versions of the optimizer extra state
     def _select(
         self,
         mask: dr.ArrayBase,
-        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]],
-        new_extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]],
+        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]],
+        new_extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]],
         /,
-    ) -> Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]]:
+    ) -> Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]]:
         # Known issue: we don't mask the update to 't' here. That would
         # require moving this parameter to the GPU, with a whole bunch
         # of downsides. It is only relevant for AMP training. Oh well.
@@ -1097,6 +1685,7 @@ class Adam(Optimizer[Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBas
             dr.select(mask, extra[1], new_extra[1]),
             dr.select(mask, extra[2], new_extra[2]),
             dr.select(mask, extra[3], new_extra[3]),
+            dr.select(mask, extra[4], new_extra[4]),
         )
 
     def __repr__(self):
@@ -1177,6 +1766,10 @@ class AdamW(Adam):
         promote_fp16: bool = True,
         uniform: bool = False,
         amsgrad: bool = False,
+        lazy: bool = False,
+        fused: bool = False,
+        state_fp16: bool = False,
+        stochastic_rounding: bool = False,
     ):
         """
         Construct a new AdamW optimizer object with decoupled weight decay.
@@ -1217,6 +1810,17 @@ class AdamW(Adam):
                 exponential moving average to normalize the gradient. This can
                 help with convergence in some cases where Adam fails.
 
+            lazy (bool):
+                If enabled, the optimizer only updates the entries of flat
+                parameters (1D arrays and tensors) that received a nonzero
+                gradient. See :py:func:`Adam.__init__()` for details on this
+                parameter. The weight decay of the skipped iterations is
+                applied in closed form, i.e., by a factor of
+                :math:`(1-\\eta\\lambda)^k` when an entry is next updated
+                :math:`k` iterations after its previous update. This uses the
+                current learning rate for all :math:`k` iterations. Entries
+                without a gradient are not decayed until then.
+
             mask_updates (bool):
                 Mask updates to zero-valued gradient components?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
@@ -1225,6 +1829,18 @@ class AdamW(Adam):
                 promoted half-precision variables to single precision internal storage?
                 See :py:func:`Optimizer.__init__()` for details on this parameter.
 
+            fused (bool):
+                Update flat parameters of the same type using a single arena?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            state_fp16 (bool):
+                Store the optimizer state in half precision?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
+            stochastic_rounding (bool):
+                Round updates of half precision values stochastically?
+                See :py:func:`Optimizer.__init__()` for details on this parameter.
+
             params (Mapping[str, drjit.ArrayBase] | None):
                 Optional dictionary-like object containing an initial set of
                 parameters.
@@ -1240,6 +1856,10 @@ class AdamW(Adam):
             promote_fp16=promote_fp16,
             uniform=uniform,
             amsgrad=amsgrad,
+            lazy=lazy,
+            fused=fused,
+            state_fp16=state_fp16,
+            stochastic_rounding=stochastic_rounding,
         )
 
         if weight_decay < 0:
@@ -1253,12 +1873,40 @@ class AdamW(Adam):
         value: dr.ArrayBase,
         grad: dr.ArrayBase,
         lr: LearningRate,
-        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]],
+        extra: Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]],
         /,
-    ) -> Tuple[dr.ArrayBase, Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase]]]:
+    ) -> Tuple[dr.ArrayBase, Tuple[int, dr.ArrayBase, dr.ArrayBase, Optional[dr.ArrayBase], Optional[dr.ArrayBase]]]:
         new_value, new_extra = super()._step(cache, value, grad, lr, extra)
-        scaled_value = dr.fma(value, -lr * self.weight_decay, new_value)
-        return scaled_value, new_extra
+
+        # Lazy mode already decayed the updated entries (see _decay_lazy())
+        if new_extra[4] is not None:
+            return new_value, new_extra
+
+        # Get opaque weight decay scale
+        decay = cache.product(
+            dr.leaf_t(grad),  # Desired type
+            lr,
+            -self.weight_decay,
+        )
+
+        return dr.fma(value, decay, new_value), new_extra
+
+    def _decay_lazy(
+        self,
+        cache: "_LRCache",
+        lr: LearningRate,
+        p: dr.ArrayBase,
+        n: dr.ArrayBase,
+        /,
+    ) -> dr.ArrayBase:
+        # Closed-form decay over the iterations since the last update
+        decay = cache.product(
+            dr.leaf_t(n),  # Desired type
+            lr,
+            -self.weight_decay,
+        )
+
+        return p * type(p)(dr.power(1 + decay, n))
 
     def __repr__(self):
         """Return a human-readable string representation"""
@@ -0,0 +1,339 @@
+from __future__ import annotations
+import sys
+import drjit as dr
+
+if sys.version_info < (3, 11):
+    from typing_extensions import List, Optional, Union
+else:
+    from typing import List, Optional, Union
+
+
+class MipTexture:
+    """
+    Mipmapped texture with trilinear and anisotropic filtering.
+
+    This class wraps a sequence of Dr.Jit textures (e.g.,
+    :py:class:`drjit.auto.Texture2f`) that store successively downsampled
+    versions of an input tensor. Level 0 holds the input itself, and each
+    following level halves the resolution along every axis until all of
+    them reach a size of one. The pyramid is built using
+    :py:func:`drjit.resample()`, hence it is computed on the device and
+    differentiable with respect to the input tensor.
+
+    Minified lookups into a single-resolution texture alias and tend to
+    thrash the cache, since neighboring query points access texels that are
+    far apart in memory. Querying a coarser pyramid level resolves both
+    problems. The class provides three types of lookups:
+
+    - :py:func:`eval()` interpolates between two adjacent levels given a
+      per-lane *level of detail* (LOD) value (trilinear filtering when the
+      underlying textures use :py:attr:`drjit.FilterMode.Linear`).
+
+    - :py:func:`eval_grad()` derives the LOD from the screen-space derivatives
+      of the lookup position (e.g., obtained via finite differences or
+      automatic differentiation).
+
+    - :py:func:`eval_aniso()` additionally takes the shape of the pixel
+      footprint into account. It places up to ``max_anisotropy`` trilinear
+      probes along the major axis of the footprint and selects a finer level
+      based on its minor axis, which preserves detail for lookups at grazing
+      angles.
+
+    The level of detail and the derivatives are specified in texels of level
+    0, i.e., a LOD of ``k`` selects level ``k``, which is ``2^k`` times
+    coarser than the input.
+
+    Example usage:
+
+    .. code-block:: python
+
+       from drjit.auto.ad import TensorXf, Array2f
+
+       tex = dr.texture.MipTexture(image) # 'image' has shape (H, W, C)
+       dpdx, dpdy = ...                   # Derivatives of 'pos' (in [0, 1]^2)
+       rgb = tex.eval_aniso(pos, dpdx, dpdy, max_anisotropy=8)
+    """
+
+    def __init__(
+        self,
+        tensor: dr.ArrayBase,
+        *,
+        filter: str = "box",
+        max_levels: Optional[int] = None,
+        use_accel: bool = True,
+        filter_mode: dr.FilterMode = dr.FilterMode.Linear,
+        wrap_mode: dr.WrapMode = dr.WrapMode.Clamp,
+        layout: dr.TextureLayout = dr.TextureLayout.RowMajor,
+    ) -> None:
+        """
+        Construct a mipmapped texture from a tensor.
+
+        Args:
+            tensor (drjit.ArrayBase): A 2D, 3D, or 4D tensor representing a
+              1D, 2D, or 3D texture. The last axis specifies the channels.
+
+            filter (str): Reconstruction filter used to downsample each
+              level, see :py:func:`drjit.resample()`. The default (``"box"``)
+              averages blocks of texels like a conventional mipmap.
+
+            max_levels (int | None): Optionally limits the number of levels
+              of the pyramid (including level 0).
+
+            use_accel (bool): Passed on to the texture of each level.
+
+            filter_mode (drjit.FilterMode): Interpolation used within each
+              level. Linear filtering combined with the interpolation between
+              levels yields trilinear filtering.
+
+            wrap_mode (drjit.WrapMode): Wrapping method used by all levels.
+
+            layout (drjit.TextureLayout): Memory layout of the texture of
+              each level.
+        """
+        if not dr.is_tensor_v(tensor) or tensor.ndim < 2 or tensor.ndim > 4:
+            raise TypeError(
+                "MipTexture(): expected a 2D, 3D, or 4D tensor (the last "
+                "axis specifies the channels)!"
+            )
+
+        tp = dr.type_v(tensor)
+        if tp == dr.VarType.Float16:
+            suffix = "f16"
+        elif tp == dr.VarType.Float32:
+            suffix = "f"
+        elif tp == dr.VarType.Float64:
+            suffix = "f64"
+        else:
+            raise TypeError("MipTexture(): unsupported tensor type!")
+
+        mod = sys.modules[type(tensor).__module__]
+        self._dim = tensor.ndim - 1
+        self._Texture = getattr(mod, f"Texture{self._dim}{suffix}")
+        self._filter = filter
+        self._max_levels = max_levels
+        self._use_accel = use_accel
+        self._filter_mode = filter_mode
+        self._wrap_mode = wrap_mode
+        self._layout = layout
+        self._levels: List = []
+
+        self.set_tensor(tensor)
+
+    def set_tensor(self, tensor: dr.ArrayBase) -> None:
+        """
+        Rebuild the pyramid from the provided tensor.
+
+        The shape of the tensor may differ from the one specified at
+        construction time, but its number of dimensions must match.
+        """
+        if tensor.ndim != self._dim + 1:
+            raise RuntimeError(
+                "MipTexture.set_tensor(): tensor dimension must equal "
+                "texture dimension plus one (channels)."
+            )
+
+        levels = []
+        shape = tuple(tensor.shape)
+        while True:
+            levels.append(
+                self._Texture(
+                    tensor,
+                    use_accel=self._use_accel,
+                    migrate=False,
+                    filter_mode=self._filter_mode,
+                    wrap_mode=self._wrap_mode,
+                    layout=self._layout,
+                )
+            )
+
+            if all(s == 1 for s in shape[:-1]) or (
+                self._max_levels is not None and len(levels) >= self._max_levels
+            ):
+                break
+
+            shape = tuple(max(s // 2, 1) for s in shape[:-1]) + shape[-1:]
+            tensor = dr.resample(tensor, shape, filter=self._filter)
+
+        self._levels = levels
+
+    @property
+    def levels(self) -> int:
+        """Return the number of levels of the pyramid"""
+        return len(self._levels)
+
+    @property
+    def shape(self) -> tuple:
+        """Return the shape of level 0 (including the channel axis)"""
+        return self._levels[0].shape
+
+    def level(self, index: int):
+        """Return the texture object representing a given level"""
+        return self._levels[index]
+
+    def tensor(self, index: int = 0) -> dr.ArrayBase:
+        """Return the tensor representation of a given level"""
+        return self._levels[index].tensor()
+
+    def lod(self, dpdx: dr.ArrayBase, dpdy: dr.ArrayBase) -> dr.ArrayBase:
+        """
+        Compute the isotropic level of detail from the screen-space
+        derivatives ``dpdx`` and ``dpdy`` of the (normalized) lookup position.
+
+        This follows the convention of graphics APIs that select the level
+        based on the longer of the two (scaled) derivative vectors.
+        """
+        px, py = self._footprint(dpdx, dpdy)
+        return dr.log2(dr.maximum(dr.maximum(px, py), 1e-20))
+
+    def eval(
+        self,
+        pos: dr.ArrayBase,
+        lod: Union[float, dr.ArrayBase] = 0.0,
+        active: Optional[dr.ArrayBase] = None,
+    ) -> List[dr.ArrayBase]:
+        """
+        Evaluate the pyramid at a continuous level of detail.
+
+        The lookup interpolates the results of the two levels bracketing
+        ``lod``, which is clamped to the range ``[0, levels - 1]``. When
+        ``lod`` is a Python scalar, only these two levels are queried.
+        Otherwise, the implementation evaluates every level with a mask that
+        disables lanes that don't need it, so memory is only accessed for the
+        two relevant levels of each lane.
+
+        Args:
+            pos (drjit.ArrayBase): Lookup position in ``[0, 1]^n``.
+
+            lod (float | drjit.ArrayBase): Level of detail.
+
+            active (drjit.ArrayBase | None): Optional mask.
+
+        Returns:
+            list[drjit.ArrayBase]: The interpolated value of each channel.
+        """
+        n = len(self._levels)
+
+        if isinstance(lod, (int, float)):
+            lod = min(max(float(lod), 0.0), float(n - 1))
+            lo = int(lod)
+            t = lod - lo
+            result = self._eval_level(lo, pos, active)
+            if t > 0:
+                upper = self._eval_level(lo + 1, pos, active)
+                result = [dr.lerp(a, b, t) for a, b in zip(result, upper)]
+            return result
+
+        lod = dr.clip(lod, 0, n - 1)
+        lo = dr.floor(lod)
+        t = lod - lo
+        result = None
+
+        for i in range(n):
+            weight = dr.select(lo == i, 1 - t, 0) + dr.select(lo == i - 1, t, 0)
+            mask = weight > 0
+            if active is not None:
+                mask &= active
+            value = self._eval_level(i, pos, mask)
+
+            if result is None:
+                result = [v * weight for v in value]
+            else:
+                result = [dr.fma(v, weight, r) for v, r in zip(value, result)]
+
+        return result
+
+    def eval_grad(
+        self,
+        pos: dr.ArrayBase,
+        dpdx: dr.ArrayBase,
+        dpdy: dr.ArrayBase,
+        active: Optional[dr.ArrayBase] = None,
+    ) -> List[dr.ArrayBase]:
+        """
+        Evaluate the pyramid with an isotropic level of detail derived from
+        the screen-space derivatives ``dpdx`` and ``dpdy`` of ``pos``.
+
+        This is equivalent to ``eval(pos, lod(dpdx, dpdy), active)``.
+        """
+        return self.eval(pos, self.lod(dpdx, dpdy), active)
+
+    def eval_aniso(
+        self,
+        pos: dr.ArrayBase,
+        dpdx: dr.ArrayBase,
+        dpdy: dr.ArrayBase,
+        max_anisotropy: int = 8,
+        active: Optional[dr.ArrayBase] = None,
+    ) -> List[dr.ArrayBase]:
+        """
+        Evaluate the pyramid with anisotropic filtering.
+
+        The pixel footprint is approximated by the parallelogram spanned by
+        the screen-space derivatives ``dpdx`` and ``dpdy``. Following the
+        ``EXT_texture_filter_anisotropic`` specification, the function
+        averages ``N = min(ceil(major / minor), max_anisotropy)`` trilinear
+        lookups distributed along the major axis. Each of them uses a level
+        of detail of ``log2(major / N)``. The implementation is fully
+        vectorized: it always traces ``max_anisotropy`` lookups and disables
+        the ones that are not needed by a given lane.
+
+        Args:
+            pos (drjit.ArrayBase): Lookup position in ``[0, 1]^n``.
+
+            dpdx (drjit.ArrayBase): Derivative of ``pos`` along the horizontal
+              screen-space axis.
+
+            dpdy (drjit.ArrayBase): Derivative of ``pos`` along the vertical
+              screen-space axis.
+
+            max_anisotropy (int): Upper bound on the ratio between the major
+              and minor axis that is resolved by additional lookups.
+
+            active (drjit.ArrayBase | None): Optional mask.
+
+        Returns:
+            list[drjit.ArrayBase]: The filtered value of each channel.
+        """
+        if max_anisotropy < 1:
+            raise RuntimeError(
+                "MipTexture.eval_aniso(): 'max_anisotropy' must be positive!"
+            )
+
+        px, py = self._footprint(dpdx, dpdy)
+        major = dr.maximum(px, py)
+        minor = dr.maximum(dr.minimum(px, py), 1e-20)
+        count = dr.minimum(dr.ceil(major / minor), max_anisotropy)
+        count = dr.maximum(count, 1)
+        lod = dr.log2(dr.maximum(major / count, 1e-20))
+        axis = dr.select(px > py, dpdx, dpdy)
+        inv_count = dr.rcp(count)
+
+        result = None
+        for k in range(max_anisotropy):
+            mask = count > k
+            if active is not None:
+                mask &= active
+            pos_k = dr.fma(axis, (k + 0.5) * inv_count - 0.5, pos)
+            value = self.eval(pos_k, lod, mask)
+            weight = dr.select(mask, inv_count, 0)
+
+            if result is None:
+                result = [v * weight for v in value]
+            else:
+                result = [dr.fma(v, weight, r) for v, r in zip(value, result)]
+
+        return result
+
+    def _eval_level(self, index, pos, active):
+        if active is None:
+            return self._levels[index].eval(pos)
+        else:
+            return self._levels[index].eval(pos, active)
+
+    def _footprint(self, dpdx, dpdy):
+        # Length of the derivatives, measured in texels of level 0. The
+        # texture shape is ordered (depth, height, width), positions are not.
+        res = self.shape[:-1][::-1]
+        px = dr.sqrt(sum((dpdx[i] * res[i]) ** 2 for i in range(self._dim)))
+        py = dr.sqrt(sum((dpdy[i] * res[i]) ** 2 for i in range(self._dim)))
+        return px, py
@@ -127,7 +127,11 @@ namespace detail {
     template <typename T> struct traversable<T, enable_if_tensor_t<T>> {
         static constexpr bool value = true;
         template <typename Tv> static DRJIT_INLINE auto fields(Tv &v) {
-            return drjit::tie(v.array());
+            // Const access to a strided view yields a temporary array
+            if constexpr (std::is_const_v<Tv>)
+                return drjit::make_tuple(v.array());
+            else
+                return drjit::tie(v.array());
         }
         template <typename Tv> static auto labels(const Tv &) {
             return make_tuple(drjit::string("array"));
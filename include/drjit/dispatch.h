@@ -0,0 +1,345 @@
+/*
+    drjit/dispatch.h -- Runtime CPU dispatch (function multiversioning) for
+    kernels based on packet arrays
+
+    Dr.Jit is a C++ template library for efficient vectorization and
+    differentiation of numerical kernels on modern processor architectures.
+
+    Copyright (c) 2021 Wenzel Jakob <wenzel.jakob@epfl.ch>
+
+    All rights reserved. Use of this source code is governed by a BSD-style
+    license that can be found in the LICENSE file.
+*/
+
+/*
+   The packet backends (drjit/packet.h) are selected at compile time based on
+   the instruction sets enabled via compiler flags. To ship a single binary to
+   machines with different capabilities, a kernel can instead be compiled
+   several times with different flags and the best variant selected at
+   runtime via CPUID. This works as follows:
+
+   1. The kernel is written in a separate source file that places all
+      functions into the namespace ``DRJIT_DISPATCH_NS``:
+
+        #include <drjit/packet.h>
+        namespace dr = drjit;
+
+        namespace DRJIT_DISPATCH_NS {
+            void saxpy(float a, const float *x, float *y, size_t n) {
+                using FloatP = dr::Packet<float>;
+                ...
+            }
+        }
+
+   2. The build system compiles this file once per instruction set using the
+      CMake function ``drjit_add_dispatch(<target> <source>)`` (see
+      resources/drjit-dispatch.cmake).
+
+   3. Code compiled with the baseline flags declares the kernel and calls it
+      through the generated dispatcher:
+
+        #include <drjit/dispatch.h>
+
+        DRJIT_DISPATCH_DECLARE(saxpy, void(float, const float *, float *, size_t))
+
+        saxpy(2.f, x, y, n); // Calls the best variant supported by the CPU
+
+   Each variant must reside in its own namespace: for example,
+   ``dr::Packet<float, 8>`` is a native AVX register in one translation unit
+   but a pair of SSE registers in another, and merging such instantiations
+   would violate the one-definition rule. To this end, this header renames the
+   ``drjit`` namespace (e.g. to ``drjit_AVX2``) within translation units
+   compiled for a specific instruction set (see the end of this file). The
+   kernel sources should therefore only rely on header-only functionality
+   (packet arrays, math library, etc.) and must not exchange Dr.Jit types with
+   code compiled for another instruction set.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define DRJIT_DISPATCH_X86 1
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#    include <immintrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+#if !defined(NAMESPACE_BEGIN)
+#  define NAMESPACE_BEGIN(name) namespace name {
+#endif
+
+#if !defined(NAMESPACE_END)
+#  define NAMESPACE_END(name) }
+#endif
+
+NAMESPACE_BEGIN(drjit)
+
+/// Instruction sets, for which separate kernel variants can be compiled
+enum class CpuIsa : uint32_t {
+    /// Compiled with the default flags of the target (always available)
+    Baseline = 0,
+    SSE42,
+    AVX,
+    /// AVX2 + FMA + F16C + BMI1/2
+    AVX2,
+    /// AVX512 F/CD/VL/DQ/BW
+    AVX512,
+    Count
+};
+
+inline const char *cpu_isa_name(CpuIsa isa) {
+    switch (isa) {
+        case CpuIsa::Baseline: return "baseline";
+        case CpuIsa::SSE42:    return "sse42";
+        case CpuIsa::AVX:      return "avx";
+        case CpuIsa::AVX2:     return "avx2";
+        case CpuIsa::AVX512:   return "avx512";
+        default:               return "unknown";
+    }
+}
+
+/// Parse the name of an instruction set (as returned by \ref cpu_isa_name())
+inline CpuIsa cpu_isa_from_name(const char *name) {
+    for (uint32_t i = 0; i < (uint32_t) CpuIsa::Count; ++i) {
+        if (strcmp(name, cpu_isa_name((CpuIsa) i)) == 0)
+            return (CpuIsa) i;
+    }
+    return CpuIsa::Count;
+}
+
+NAMESPACE_BEGIN(detail)
+
+#if defined(DRJIT_DISPATCH_X86)
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#  if defined(_MSC_VER)
+    int tmp[4];
+    __cpuidex(tmp, (int) leaf, (int) subleaf);
+    memcpy(regs, tmp, sizeof(tmp));
+#  else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#  endif
+}
+
+inline uint64_t xgetbv() {
+#  if defined(_MSC_VER)
+    return (uint64_t) _xgetbv(0);
+#  else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t) edx << 32) | eax;
+#  endif
+}
+#endif
+
+NAMESPACE_END(detail)
+
+/// Query the most capable instruction set supported by the CPU and OS
+inline CpuIsa cpu_isa_detect() {
+#if defined(DRJIT_DISPATCH_X86)
+    uint32_t r1[4] = { 0 }, r7[4] = { 0 }, max_leaf[4] = { 0 };
+    detail::cpuid(0, 0, max_leaf);
+    if (max_leaf[0] < 1)
+        return CpuIsa::Baseline;
+
+    detail::cpuid(1, 0, r1);
+    if (max_leaf[0] >= 7)
+        detail::cpuid(7, 0, r7);
+
+    auto bit = [](uint32_t value, uint32_t i) { return (value >> i) & 1; };
+
+    bool sse42   = bit(r1[2], 20),
+         osxsave = bit(r1[2], 27),
+         avx     = bit(r1[2], 28),
+         fma     = bit(r1[2], 12),
+         f16c    = bit(r1[2], 29),
+         avx2    = bit(r7[1], 5),
+         bmi1    = bit(r7[1], 3),
+         bmi2    = bit(r7[1], 8),
+         avx512  = bit(r7[1], 16) && bit(r7[1], 17) && bit(r7[1], 28) &&
+                   bit(r7[1], 30) && bit(r7[1], 31);
+
+    // Check that the OS saves the YMM/ZMM register state
+    uint64_t xcr0 = osxsave ? detail::xgetbv() : 0;
+    bool os_avx    = (xcr0 & 0x06) == 0x06,
+         os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+    if (avx512 && avx2 && fma && f16c && bmi1 && bmi2 && os_avx512)
+        return CpuIsa::AVX512;
+    else if (avx2 && fma && f16c && bmi1 && bmi2 && os_avx)
+        return CpuIsa::AVX2;
+    else if (avx && os_avx)
+        return CpuIsa::AVX;
+    else if (sse42)
+        return CpuIsa::SSE42;
+#endif
+    return CpuIsa::Baseline;
+}
+
+NAMESPACE_BEGIN(detail)
+/// Upper limit on the instruction set used by dispatched kernels
+inline std::atomic<uint32_t> cpu_isa_limit { (uint32_t) CpuIsa::Count };
+NAMESPACE_END(detail)
+
+/**
+ * \brief Return the instruction set used to select dispatched kernels
+ *
+ * This is the instruction set detected via \ref cpu_isa_detect(), optionally
+ * limited using \ref set_cpu_isa_limit() or the ``DRJIT_CPU_ISA`` environment
+ * variable (e.g. ``DRJIT_CPU_ISA=avx``).
+ */
+inline CpuIsa cpu_isa() {
+    static const CpuIsa detected = [] {
+        CpuIsa isa = cpu_isa_detect();
+        const char *env = getenv("DRJIT_CPU_ISA");
+        if (env) {
+            CpuIsa limit = cpu_isa_from_name(env);
+            if (limit < isa)
+                isa = limit;
+        }
+        return isa;
+    }();
+
+    CpuIsa limit = (CpuIsa) detail::cpu_isa_limit.load(std::memory_order_relaxed);
+    return limit < detected ? limit : detected;
+}
+
+/**
+ * \brief Limit the instruction set used by dispatched kernels
+ *
+ * This is mainly useful to test the individual kernel variants. Passing
+ * ``CpuIsa::Count`` removes the limit.
+ */
+inline void set_cpu_isa_limit(CpuIsa isa) {
+    detail::cpu_isa_limit.store((uint32_t) isa, std::memory_order_relaxed);
+}
+
+template <typename Func> struct DispatchTable;
+
+/**
+ * \brief Table of kernel variants compiled for different instruction sets
+ *
+ * Calling the table forwards the arguments to the most capable variant that
+ * is supported by the current CPU (see \ref cpu_isa()).
+ */
+template <typename Ret, typename... Args> struct DispatchTable<Ret(Args...)> {
+    using Func = Ret (*)(Args...);
+
+    void set(CpuIsa isa, Func func) { m_funcs[(uint32_t) isa] = func; }
+
+    /// Return the instruction set of the variant that would be called
+    CpuIsa resolve_isa(CpuIsa max_isa = cpu_isa()) const {
+        for (uint32_t i = (uint32_t) max_isa + 1; i > 0; --i) {
+            if (i - 1 < (uint32_t) CpuIsa::Count && m_funcs[i - 1])
+                return (CpuIsa) (i - 1);
+        }
+        return CpuIsa::Count;
+    }
+
+    Func resolve(CpuIsa max_isa = cpu_isa()) const {
+        CpuIsa isa = resolve_isa(max_isa);
+        if (isa == CpuIsa::Count)
+            throw std::runtime_error(
+                "drjit::DispatchTable: no compatible kernel variant!");
+        return m_funcs[(uint32_t) isa];
+    }
+
+    template <typename... Args2> Ret operator()(Args2 &&...args) const {
+        return resolve()(std::forward<Args2>(args)...);
+    }
+
+private:
+    Func m_funcs[(uint32_t) CpuIsa::Count] { };
+};
+
+NAMESPACE_END(drjit)
+
+// Namespaces of the kernel variants compiled for each instruction set
+#define DRJIT_DISPATCH_CONCAT_(a, b) a##b
+#define DRJIT_DISPATCH_CONCAT(a, b) DRJIT_DISPATCH_CONCAT_(a, b)
+
+#if defined(DRJIT_DISPATCH_HAS_BASELINE)
+#  define DRJIT_DISPATCH_IF_BASELINE(x) x
+#else
+#  define DRJIT_DISPATCH_IF_BASELINE(x)
+#endif
+#if defined(DRJIT_DISPATCH_HAS_SSE42)
+#  define DRJIT_DISPATCH_IF_SSE42(x) x
+#else
+#  define DRJIT_DISPATCH_IF_SSE42(x)
+#endif
+#if defined(DRJIT_DISPATCH_HAS_AVX)
+#  define DRJIT_DISPATCH_IF_AVX(x) x
+#else
+#  define DRJIT_DISPATCH_IF_AVX(x)
+#endif
+#if defined(DRJIT_DISPATCH_HAS_AVX2)
+#  define DRJIT_DISPATCH_IF_AVX2(x) x
+#else
+#  define DRJIT_DISPATCH_IF_AVX2(x)
+#endif
+#if defined(DRJIT_DISPATCH_HAS_AVX512)
+#  define DRJIT_DISPATCH_IF_AVX512(x) x
+#else
+#  define DRJIT_DISPATCH_IF_AVX512(x)
+#endif
+
+#define DRJIT_DISPATCH_VARIANT(Isa, Name)                                      \
+    namespace drjit_isa_##Isa { extern Name##_type Name; }
+
+#define DRJIT_DISPATCH_REGISTER(Value, Isa, Name)                              \
+    table.set(::drjit::CpuIsa::Value, &drjit_isa_##Isa::Name);
+
+/**
+ * \brief Declare a kernel compiled for several instruction sets, and define a
+ * function of the same name that dispatches to the best variant
+ *
+ * \c Signature is the function type of the kernel, e.g. ``void(float *, size_t)``.
+ *
+ * The macro also defines ``<Name>_dispatch()``, which returns the underlying
+ * \ref DispatchTable. It must be used in code compiled with the baseline flags
+ * and placed into the same namespace that encloses ``DRJIT_DISPATCH_NS`` in the
+ * kernel source.
+ */
+#define DRJIT_DISPATCH_DECLARE(Name, Signature)                                \
+    using Name##_type = Signature;                                             \
+    DRJIT_DISPATCH_IF_BASELINE(DRJIT_DISPATCH_VARIANT(BASELINE, Name))         \
+    DRJIT_DISPATCH_IF_SSE42(DRJIT_DISPATCH_VARIANT(SSE42, Name))               \
+    DRJIT_DISPATCH_IF_AVX(DRJIT_DISPATCH_VARIANT(AVX, Name))                   \
+    DRJIT_DISPATCH_IF_AVX2(DRJIT_DISPATCH_VARIANT(AVX2, Name))                 \
+    DRJIT_DISPATCH_IF_AVX512(DRJIT_DISPATCH_VARIANT(AVX512, Name))             \
+    inline const ::drjit::DispatchTable<Name##_type> &Name##_dispatch() {      \
+        static const ::drjit::DispatchTable<Name##_type> result = [] {         \
+            ::drjit::DispatchTable<Name##_type> table;                         \
+            DRJIT_DISPATCH_IF_BASELINE(DRJIT_DISPATCH_REGISTER(Baseline, BASELINE, Name)) \
+            DRJIT_DISPATCH_IF_SSE42(DRJIT_DISPATCH_REGISTER(SSE42, SSE42, Name)) \
+            DRJIT_DISPATCH_IF_AVX(DRJIT_DISPATCH_REGISTER(AVX, AVX, Name))     \
+            DRJIT_DISPATCH_IF_AVX2(DRJIT_DISPATCH_REGISTER(AVX2, AVX2, Name))  \
+            DRJIT_DISPATCH_IF_AVX512(DRJIT_DISPATCH_REGISTER(AVX512, AVX512, Name)) \
+            return table;                                                      \
+        }();                                                                   \
+        return result;                                                         \
+    }                                                                          \
+    template <typename... Args>                                                \
+    decltype(auto) Name(Args &&...args) {                                      \
+        return Name##_dispatch()(std::forward<Args>(args)...);                 \
+    }
+
+/* Within a translation unit compiled for a specific instruction set (as set
+   up by ``drjit_add_dispatch()``), place all subsequently included Dr.Jit
+   code into a separate namespace. ``drjit_dispatch`` continues to refer to
+   the shared definitions above. */
+#if defined(DRJIT_DISPATCH_ISA)
+#  define DRJIT_DISPATCH_NS DRJIT_DISPATCH_CONCAT(drjit_isa_, DRJIT_DISPATCH_ISA)
+namespace drjit_dispatch = drjit;
+#  define drjit DRJIT_DISPATCH_CONCAT(drjit_, DRJIT_DISPATCH_ISA)
+#endif
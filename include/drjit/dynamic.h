@@ -1,6 +1,6 @@
 /*
-    drjit/dynamic.h -- Naive dynamic array (extremely inefficient, CUDA/LLVM
-    arrays are almost always preferable)
+    drjit/dynamic.h -- Dynamically sized array for CPU computation without
+    tracing (CUDA/LLVM arrays are usually preferable for large workloads)
 
     Dr.Jit is a C++ template library for efficient vectorization and
     differentiation of numerical kernels on modern processor architectures.
@@ -13,8 +13,10 @@
 
 #pragma once
 
-#include <drjit/array.h>
+#include <drjit/packet.h>
+#include <algorithm>
 #include <limits>
+#include <memory>
 
 NAMESPACE_BEGIN(drjit)
 
@@ -41,22 +43,37 @@ struct DynamicArray
     using Base::Base;
     using Base::entry;
 
+    /// Alignment of heap-allocated storage (one cache line)
+    static constexpr size_t Alignment =
+        alignof(Value) > 64 ? alignof(Value) : 64;
+
+    /// Can the contents be copied and destroyed without invoking constructors?
+    static constexpr bool IsTrivial = std::is_trivially_copyable_v<Value>;
+
+    /**
+     * \brief Number of elements stored inline without a heap allocation
+     *
+     * Many arrays only hold a single element (e.g. when a scalar is broadcast
+     * to a dynamic array), so short arrays of trivial types are stored in a
+     * small buffer within the array object.
+     */
+    static constexpr size_t SmallSize =
+        (IsTrivial && std::is_trivially_default_constructible_v<Value> &&
+         sizeof(Value) <= 16) ? 32 / sizeof(Value) : 0;
+
+    /// Use packets for element-wise arithmetic with this value type?
+    static constexpr bool IsPacketizable =
+        std::is_arithmetic_v<Value> && !std::is_same_v<Value, bool> &&
+        sizeof(Value) >= 4 && Packet<Value>::Size > 1;
+
     DynamicArray() = default;
 
-    DynamicArray(const DynamicArray &a) : m_size(a.m_size) {
-        if (!empty()) {
-            m_data = new Value[m_size];
-            for (size_t i = 0; i < m_size; ++i)
-                m_data[i] = a.m_data[i];
-        }
+    DynamicArray(const DynamicArray &a) {
+        init_(a.m_size);
+        copy_(m_data, a.m_data, m_size);
     }
 
-    DynamicArray(DynamicArray &&a)
-        : m_data(a.m_data), m_size(a.m_size), m_free(a.m_free) {
-        a.m_size = 0;
-        a.m_data = nullptr;
-        a.m_free = true;
-    }
+    DynamicArray(DynamicArray &&a) noexcept { steal_(a); }
 
     template <typename Value2, bool IsMask2, typename Derived2>
     DynamicArray(const ArrayBaseT<Value2, IsMask2, Derived2> &v) {
@@ -98,27 +115,28 @@ struct DynamicArray
             m_data[i] = std::move(data[i]);
     }
 
-    ~DynamicArray() {
-        if (m_free)
-            delete[] m_data;
-    }
+    ~DynamicArray() { release_(); }
 
     DynamicArray &operator=(const DynamicArray &a) {
-        Value* new_data = new Value[a.m_size];
-        for (size_t i = 0; i < a.m_size; ++i)
-            new_data[i] = a.m_data[i];
-        if (m_free)
-            delete[] m_data;
-        m_size = a.m_size;
-        m_data = new_data;
-        m_free = true;
+        if (this == &a)
+            return *this;
+
+        // Reuse the existing storage when possible (but never write to
+        // memory that was provided via map_())
+        if (m_size != a.m_size || !(m_free || is_small_())) {
+            release_();
+            init_(a.m_size);
+        }
+
+        copy_(m_data, a.m_data, m_size);
         return *this;
     }
 
-    DynamicArray &operator=(DynamicArray &&a) {
-        std::swap(a.m_data, m_data);
-        std::swap(a.m_free, m_free);
-        std::swap(a.m_size, m_size);
+    DynamicArray &operator=(DynamicArray &&a) noexcept {
+        if (this != &a) {
+            release_();
+            steal_(a);
+        }
         return *this;
     }
 
@@ -143,7 +161,8 @@ struct DynamicArray
         result.init_(size);
 
         if constexpr (drjit::detail::is_scalar_v<Value>) {
-            memcpy(result.m_data, ptr, sizeof(Value) * size);
+            if (size)
+                memcpy(result.m_data, ptr, sizeof(Value) * size);
         } else {
             for (size_t i = 0; i < size; ++i)
                 result.entry(i) =
@@ -154,7 +173,8 @@ struct DynamicArray
     }
 
     void store_(void *ptr) const {
-        memcpy(ptr, m_data, sizeof(Value) * m_size);
+        if (m_size)
+            memcpy(ptr, m_data, sizeof(Value) * m_size);
     }
 
     static DynamicArray empty_(size_t size) {
@@ -167,8 +187,13 @@ struct DynamicArray
         DynamicArray result;
         result.init_(size);
 
-        for (size_t i = 0; i < size; ++i)
-            result.entry(i) = zeros<Value>();
+        if constexpr (drjit::detail::is_scalar_v<Value>) {
+            if (size)
+                memset((void *) result.m_data, 0, sizeof(Value) * size);
+        } else {
+            for (size_t i = 0; i < size; ++i)
+                result.m_data[i] = zeros<Value>();
+        }
 
         return result;
     }
@@ -176,13 +201,95 @@ struct DynamicArray
     static DynamicArray full_(const Value &v, size_t size) {
         DynamicArray result;
         result.init_(size);
+        std::fill_n(result.m_data, size, v);
+        return result;
+    }
 
-        for (size_t i = 0; i < size; ++i)
-            result.entry(i) = v;
+    // -----------------------------------------------------------------------
+    //! @{ \name Element-wise arithmetic (packetized for arithmetic types)
+    // -----------------------------------------------------------------------
+
+    #define DRJIT_DYNAMIC_BINARY(name, op, cond, packetize)                    \
+        DynamicArray name##_(const DynamicArray &v) const {                    \
+            if constexpr (cond) {                                              \
+                return binary_<packetize>(                                     \
+                    v, #name "_",                                              \
+                    [](const auto &a, const auto &b) DRJIT_INLINE_LAMBDA {     \
+                        return op;                                             \
+                    });                                                        \
+            } else {                                                           \
+                return Base::name##_(v);                                       \
+            }                                                                  \
+        }
 
-        return result;
+    DRJIT_DYNAMIC_BINARY(add, a + b, Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_BINARY(sub, a - b, Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_BINARY(mul, a * b, Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_BINARY(div, a / b, Base::IsArithmetic, Base::IsFloat)
+    DRJIT_DYNAMIC_BINARY(minimum, drjit::minimum(a, b), Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_BINARY(maximum, drjit::maximum(a, b), Base::IsArithmetic, true)
+
+    #undef DRJIT_DYNAMIC_BINARY
+
+    #define DRJIT_DYNAMIC_UNARY(name, op, cond, packetize)                     \
+        DynamicArray name##_() const {                                         \
+            if constexpr (cond) {                                              \
+                return unary_<packetize>(                                      \
+                    [](const auto &a) DRJIT_INLINE_LAMBDA { return op; });     \
+            } else {                                                           \
+                return Base::name##_();                                        \
+            }                                                                  \
+        }
+
+    DRJIT_DYNAMIC_UNARY(neg, -a, Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_UNARY(abs, drjit::abs(a), Base::IsArithmetic, true)
+    DRJIT_DYNAMIC_UNARY(sqrt, drjit::sqrt(a), Base::IsFloat, true)
+    DRJIT_DYNAMIC_UNARY(floor, drjit::floor(a), Base::IsFloat, true)
+    DRJIT_DYNAMIC_UNARY(ceil, drjit::ceil(a), Base::IsFloat, true)
+    DRJIT_DYNAMIC_UNARY(trunc, drjit::trunc(a), Base::IsFloat, true)
+    DRJIT_DYNAMIC_UNARY(round, drjit::round(a), Base::IsFloat, true)
+
+    // Packet versions of these are approximate, keep the scalar semantics
+    DRJIT_DYNAMIC_UNARY(rcp, drjit::rcp(a), Base::IsFloat, false)
+    DRJIT_DYNAMIC_UNARY(rsqrt, drjit::rsqrt(a), Base::IsFloat, false)
+
+    #undef DRJIT_DYNAMIC_UNARY
+
+    DynamicArray fmadd_(const DynamicArray &b, const DynamicArray &c) const {
+        if constexpr (IsPacketizable) {
+            size_t sa = m_size, sb = b.m_size, sc = c.m_size,
+                   sr = drjit::maximum(sa, drjit::maximum(sb, sc));
+
+            if ((sa != sr && sa != 1) || (sb != sr && sb != 1) ||
+                (sc != sr && sc != 1))
+                drjit_raise("fmadd_() : incompatible input sizes "
+                            "(%zu, %zu, and %zu)", sa, sb, sc);
+
+            // Only the common case (no broadcasting) is packetized
+            if (sa == sr && sb == sr && sc == sr) {
+                using P = Packet<Value>;
+                DynamicArray result = empty_(sr);
+                const Value *pa = m_data, *pb = b.m_data, *pc = c.m_data;
+                Value *pr = result.m_data;
+
+                size_t i = 0;
+                for (; i + P::Size <= sr; i += P::Size)
+                    drjit::store(pr + i, drjit::fmadd(drjit::load<P>(pa + i),
+                                                      drjit::load<P>(pb + i),
+                                                      drjit::load<P>(pc + i)));
+                for (; i < sr; ++i)
+                    pr[i] = drjit::fmadd(pa[i], pb[i], pc[i]);
+
+                return result;
+            }
+        }
+
+        return Base::fmadd_(b, c);
     }
 
+    //! @}
+    // -----------------------------------------------------------------------
+
     static DynamicArray arange_(ssize_t start, ssize_t stop, ssize_t step) {
         size_t size = size_t((stop - start + step - (step > 0 ? 1 : -1)) / step);
         DynamicArray result;
@@ -403,9 +510,18 @@ struct DynamicArray
     void init_(size_t size) {
         if (size == 0)
             return;
-        m_data = new Value[size];
+
+        if (size <= SmallSize) {
+            m_data = small_();
+            m_free = false;
+        } else {
+            m_data = alloc_(size);
+            if constexpr (!std::is_trivially_default_constructible_v<Value>)
+                std::uninitialized_default_construct_n(m_data, size);
+            m_free = true;
+        }
+
         m_size = size;
-        m_free = true;
     }
 
     static DynamicArray map_(Value *value, size_t size) {
@@ -428,9 +544,134 @@ struct DynamicArray
     Value *data() { return m_data; }
 
 protected:
+    Value *small_() { return (Value *) &m_small; }
+    bool is_small_() const {
+        return SmallSize > 0 && m_data == (const Value *) &m_small;
+    }
+
+    /**
+     * Allocate aligned heap storage. This over-allocates via \c malloc() and
+     * stores the original pointer in front of the returned address, which is
+     * considerably faster than \c aligned_alloc() on some platforms.
+     */
+    static Value *alloc_(size_t size) {
+        void *ptr = malloc(sizeof(Value) * size + Alignment);
+        if (!ptr)
+            drjit_raise("DynamicArray: out of memory!");
+        uintptr_t aligned =
+            ((uintptr_t) ptr + Alignment) & ~(uintptr_t) (Alignment - 1);
+        ((void **) aligned)[-1] = ptr;
+        return (Value *) aligned;
+    }
+
+    static void copy_(Value *dst, const Value *src, size_t size) {
+        if constexpr (IsTrivial) {
+            if (size)
+                memcpy((void *) dst, (const void *) src, sizeof(Value) * size);
+        } else {
+            std::copy_n(src, size, dst);
+        }
+    }
+
+    /// Release heap-allocated storage
+    void release_() {
+        if (m_free && m_data) {
+            if constexpr (!std::is_trivially_destructible_v<Value>)
+                std::destroy_n(m_data, m_size);
+            free(((void **) m_data)[-1]);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_free = true;
+    }
+
+    /// Take over the contents of 'a' and leave it empty
+    void steal_(DynamicArray &a) {
+        if (a.is_small_()) {
+            m_data = small_();
+            copy_(m_data, a.m_data, a.m_size);
+        } else {
+            m_data = a.m_data;
+        }
+        m_size = a.m_size;
+        m_free = a.m_free;
+        a.m_data = nullptr;
+        a.m_size = 0;
+        a.m_free = true;
+    }
+
+    /**
+     * Apply a unary operation, optionally using packets. The loop accesses
+     * 'm_data' through local pointers rather than entry(), which lets the
+     * compiler vectorize it even when it is not packetized explicitly.
+     */
+    template <bool Packetize, typename Func>
+    DRJIT_INLINE DynamicArray unary_(Func func) const {
+        size_t size = m_size;
+        DynamicArray result = empty_(size);
+        const Value *pa = m_data;
+        Value *pr = result.m_data;
+        size_t i = 0;
+
+        if constexpr (Packetize && IsPacketizable) {
+            using P = Packet<Value>;
+            for (; i + P::Size <= size; i += P::Size)
+                drjit::store(pr + i, func(drjit::load<P>(pa + i)));
+        }
+
+        for (; i < size; ++i)
+            pr[i] = (Value) func(pa[i]);
+
+        return result;
+    }
+
+    /// Apply a binary operation with broadcasting, optionally using packets
+    template <bool Packetize, typename Func>
+    DRJIT_INLINE DynamicArray binary_(const DynamicArray &v, const char *name,
+                                      Func func) const {
+        size_t sa = m_size, sb = v.m_size, sr = sa > sb ? sa : sb;
+        if ((sa != sr && sa != 1) || (sb != sr && sb != 1))
+            drjit_raise("%s() : incompatible input sizes (%zu and %zu)", name,
+                        sa, sb);
+
+        DynamicArray result = empty_(sr);
+        const Value *pa = m_data, *pb = v.m_data;
+        Value *pr = result.m_data;
+        size_t i = 0;
+
+        if constexpr (Packetize && IsPacketizable) {
+            using P = Packet<Value>;
+            if (sa == sr && sb == sr) {
+                for (; i + P::Size <= sr; i += P::Size)
+                    drjit::store(pr + i, func(drjit::load<P>(pa + i),
+                                              drjit::load<P>(pb + i)));
+            } else if (sa == sr) {
+                P b = pb[0];
+                for (; i + P::Size <= sr; i += P::Size)
+                    drjit::store(pr + i, func(drjit::load<P>(pa + i), b));
+            } else if (sb == sr) {
+                P a = pa[0];
+                for (; i + P::Size <= sr; i += P::Size)
+                    drjit::store(pr + i, func(a, drjit::load<P>(pb + i)));
+            }
+        }
+
+        for (; i < sr; ++i)
+            pr[i] = (Value) func(pa[sa == 1 ? 0 : i], pb[sb == 1 ? 0 : i]);
+
+        return result;
+    }
+
     Value *m_data = nullptr;
     size_t m_size = 0;
     bool m_free = true;
+
+    /* Inline storage for short arrays (see \ref SmallSize). This is
+       deliberately not a 'char' buffer, which the compiler would have to
+       assume to alias the array contents in element-wise loops. */
+    struct NoSmallStorage { };
+    std::conditional_t<(SmallSize > 0), Value[SmallSize ? SmallSize : 1],
+                       NoSmallStorage> m_small;
 };
 
 NAMESPACE_END(drjit)
@@ -490,6 +490,11 @@ extern DRJIT_EXTRA_EXPORT uint64_t ad_var_map_get(uint64_t index);
 extern DRJIT_EXTRA_EXPORT int ad_leak_warnings();
 extern DRJIT_EXTRA_EXPORT void ad_set_leak_warnings(int value);
 
+/// Query/set whether cooperative vector gradients are accumulated using
+/// ReduceMode::Expand on the LLVM backend (instead of atomic operations)
+extern DRJIT_EXTRA_EXPORT int ad_coop_vec_expand();
+extern DRJIT_EXTRA_EXPORT void ad_set_coop_vec_expand(int value);
+
 /// Extract the i-th predecessor of an AD node (or return 0)
 extern DRJIT_EXTRA_EXPORT uint32_t ad_pred(uint32_t index, uint32_t i);
 
@@ -558,3 +563,41 @@ extern DRJIT_EXTRA_EXPORT uint64_t ad_coop_vec_matvec(uint64_t A_index,
 
 /// Cast a cooperative vector to a different precision
 extern DRJIT_EXTRA_EXPORT uint64_t ad_coop_vec_cast(uint64_t index, VarType vt);
+
+/// --------------------- Hash grid encoding API ---------------------
+
+/// Describes one resolution level of a multiresolution hash grid
+struct HashGridLevel {
+    /// Scale factor applied to positions before locating the voxel
+    double scale;
+
+    /// Number of grid vertices along each dimension
+    uint32_t resolution;
+
+    /// Index of the first feature vector of this level
+    uint32_t offset;
+
+    /// Number of feature vectors stored by this level
+    uint32_t size;
+};
+
+/**
+ * \brief Evaluate a multiresolution hash grid encoding
+ *
+ * Interpolates the ``n_features`` features stored at the ``2^dimension``
+ * corners of the voxel containing each position on each of the ``n_levels``
+ * levels. The feature vectors are stored contiguously in ``data``. The
+ * positions ``pos`` are JIT variable indices and are treated as
+ * non-differentiable. ``active`` may be zero to evaluate all lanes.
+ *
+ * The function writes ``n_levels * n_features`` AD variable indices with
+ * the type of ``data`` to ``out``. The caller must release them. When
+ * ``data`` is attached to the AD graph, the operation is tracked by a single
+ * ``CustomOp`` node. Its reverse-mode derivative recomputes the lookup
+ * indices and issues the scatters into the gradient of ``data`` one level
+ * at a time.
+ */
+extern DRJIT_EXTRA_EXPORT void
+ad_hashgrid_encode(uint64_t data, uint32_t n_features, uint32_t dimension,
+                   const uint32_t *pos, double pos_offset, uint32_t n_levels,
+                   const HashGridLevel *levels, uint32_t active, uint64_t *out);
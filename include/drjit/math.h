@@ -1618,4 +1618,277 @@ template <typename Value> Value lgamma(Value x_) {
     }
 }
 
+// -----------------------------------------------------------------------
+//! @{ \name Reduced-accuracy transcendental functions
+// -----------------------------------------------------------------------
+
+/*
+   The functions above target an accuracy of a few ulp in single precision.
+   The namespaces 'drjit::fast' and 'drjit::approx' provide variants based on
+   shorter polynomials that trade accuracy for throughput:
+
+   - fast::*:   max. error of ~4 ulp in single precision
+   - approx::*: max. relative error of ~1e-5
+
+   There are no reduced-accuracy variants of atan() and atan2(). A few-ulp
+   polynomial has the same degree as the default one, and the throughput
+   gained by a lower-degree fit did not justify its error of 75 ulp.
+
+   Fits were computed using 'resources/remez.cpp', and the listed errors were
+   measured using 'resources/math-bench.cpp'.
+
+   Reduced-accuracy polynomials only exist for single precision: half
+   precision arguments are evaluated in single precision, and double precision
+   arguments use the default implementation. The same is true for
+   differentiable arrays with enabled gradient tracking, since the default
+   implementation provides an analytic derivative. On the CUDA backend,
+   exp/exp2/log/log2/sin/cos retain the hardware approximations used by the
+   default implementation.
+*/
+
+NAMESPACE_BEGIN(detail)
+
+enum class Accuracy { Precise, Fast, Approx };
+
+/// Route a reduced-accuracy function call based on the argument type
+template <Accuracy Acc, typename Value, typename Func, typename Fallback>
+DRJIT_INLINE Value tiered(const Value &x, const Func &func,
+                          const Fallback &fallback) {
+    using Scalar = scalar_t<Value>;
+    static_assert(drjit::is_floating_point_v<Scalar>,
+                  "Reduced-accuracy functions require a floating point argument!");
+
+    if constexpr (Acc == Accuracy::Precise || std::is_same_v<Scalar, double>) {
+        return fallback(x);
+    } else if constexpr (is_half_v<Value>) {
+        return Value(tiered<Acc>(float32_array_t<Value>(x), func, fallback));
+    } else if constexpr (is_diff_v<Value>) {
+        if (grad_enabled(x))
+            return fallback(x);
+        return Value(tiered<Acc>(detach<false>(x), func, fallback));
+    } else if constexpr (backend_v<Value> == JitBackend::CUDA) {
+        return fallback(x);
+    } else {
+        return func(x);
+    }
+}
+
+template <Accuracy Acc, typename Value>
+DRJIT_INLINE Value exp2_tier(const Value &x) {
+    /* Total error on [-20, 30]:
+        - fast::exp2:   avg = 0.84 ulp, max = 2.97 ulp
+        - approx::exp2: avg = 19.2 ulp, max = 35.8 ulp */
+    using Scalar = scalar_t<Value>;
+    using Mask = mask_t<Value>;
+
+    Mask mask_overflow  = x >  Scalar(127),
+         mask_underflow = x < -Scalar(127);
+
+    // Separate into integer and fractional parts, y in [-1/2, 1/2]
+    Value n = round(x),
+          y = x - n, z;
+
+    if constexpr (Acc == Accuracy::Fast)
+        z = estrin(y, 0x1p+0, 0x1.62e426p-1, 0x1.ebf944p-3,
+                      0x1.c6b6dcp-5, 0x1.3d0c7p-7, 0x1.5c08e6p-10);
+    else
+        z = estrin(y, 0x1.ffffdcp-1, 0x1.62e0cep-1, 0x1.ec0706p-3,
+                      0x1.ca147p-5, 0x1.3997d6p-7);
+
+    return select(mask_overflow, Infinity<Value>,
+                  select(mask_underflow, zeros<Value>(), ldexp(z, n)));
+}
+
+template <Accuracy Acc, typename Value>
+DRJIT_INLINE Value exp_tier(const Value &x) {
+    /* Total error on [-20, 30]:
+        - fast::exp:   avg = 0.76 ulp, max = 3.49 ulp
+        - approx::exp: avg = 19.1 ulp, max = 34.7 ulp */
+    using Scalar = scalar_t<Value>;
+    using Mask = mask_t<Value>;
+
+    const Scalar range = Scalar(88.3762588501);
+
+    Mask mask_overflow  = x >  range,
+         mask_underflow = x < -range;
+
+    // e^x = e^y 2^n with y in [-log(2)/2, log(2)/2]
+    Value n = round(x * InvLogTwo<Scalar>);
+
+    // -log(2), most significant bits & remaining bits
+    Value y = fmadd(n, Scalar(-0.693359375), x);
+    y = fmadd(n, Scalar(2.12194440e-4), y);
+
+    Value z;
+    if constexpr (Acc == Accuracy::Fast)
+        z = estrin(y, 0x1.000002p+0, 0x1.fffff6p-1, 0x1.fffcd4p-2,
+                      0x1.555a08p-3, 0x1.575f26p-5, 0x1.0fe5c6p-7);
+    else
+        z = estrin(y, 0x1.ffffd8p-1, 0x1.fffb2p-1, 0x1.000624p-1,
+                      0x1.57e098p-3, 0x1.53a1p-5);
+
+    return select(mask_overflow, Infinity<Value>,
+                  select(mask_underflow, zeros<Value>(), ldexp(z, n)));
+}
+
+template <Accuracy Acc, bool Base2, typename Value>
+DRJIT_INLINE Value log_tier(const Value &x) {
+    /* Total error on [1e-20, 1000]:
+        - fast::log:    avg = 0.25 ulp, max = 3.25 ulp
+        - approx::log:  avg = 1.92 ulp, max = 131 ulp
+        - fast::log2:   avg = 0.25 ulp, max = 3.97 ulp
+        - approx::log2: avg = 1.67 ulp, max = 133 ulp */
+    using Scalar = scalar_t<Value>;
+    using Mask = mask_t<Value>;
+
+    // Catch negative and NaN values
+    Mask valid_mask = x >= Scalar(0);
+
+    // Note: does not handle denormalized numbers on some target
+    auto [xm, e] = frexp(x);
+
+    Mask mask_ge_inv_sqrt2 = xm >= InvSqrtTwo<Scalar>;
+
+    masked(e, mask_ge_inv_sqrt2) += Scalar(1);
+    xm += detail::andnot_(xm, mask_ge_inv_sqrt2) - Scalar(1);
+
+    // log(1+x) = x P(x) with x in [sqrt(1/2) - 1, sqrt(2) - 1]
+    Value y;
+    if constexpr (Acc == Accuracy::Fast)
+        y = estrin(xm, 0x1p+0, -0x1.fffffcp-2, 0x1.55578ep-2,
+                      -0x1.00057p-2, 0x1.98b744p-3, -0x1.533296p-3,
+                       0x1.3238e6p-3, -0x1.263ba4p-3, 0x1.654492p-4);
+    else
+        y = estrin(xm, 0x1.000046p+0, -0x1.ffe624p-2, 0x1.548fe8p-2,
+                      -0x1.042168p-2, 0x1.c3b488p-3, -0x1.24b3a2p-3);
+    y *= xm;
+
+    Value r;
+    if constexpr (Base2) {
+        r = fmadd(y, InvLogTwo<Scalar>, e);
+    } else {
+        r = fmadd(e, Scalar(-2.121944400546905827679e-4), y);
+        r = fmadd(e, Scalar(0.693359375), r);
+    }
+
+    // Explicit handling of special cases
+    const Scalar n_inf(-Infinity<Scalar>),
+                 p_inf( Infinity<Scalar>);
+
+    masked(r, x == p_inf) = p_inf;
+    masked(r, x == Scalar(0)) = n_inf;
+
+    return detail::or_(r, !valid_mask);
+}
+
+/// sin(y) for y in [-Pi/2, Pi/2], with a sign flip controlled by 'j'
+template <Accuracy Acc, typename Value, typename IntArray>
+DRJIT_INLINE Value sin_tier_poly(const Value &y, const IntArray &j) {
+    Value z = square(y), p;
+
+    if constexpr (Acc == Accuracy::Fast)
+        p = estrin(z, 0x1p+0, -0x1.555548p-3, 0x1.110e78p-7,
+                     -0x1.9f6434p-13, 0x1.5d38b6p-19);
+    else
+        p = estrin(z, 0x1.ffffe2p-1, -0x1.554f98p-3, 0x1.105da4p-7,
+                     -0x1.83b972p-13);
+
+    // Flip the sign when 'j' is odd
+    constexpr size_t Shift = sizeof(scalar_t<IntArray>) * 8 - 1;
+    return detail::xor_(p * y, reinterpret_array<Value>(sl<Shift>(j)));
+}
+
+template <Accuracy Acc, typename Value>
+DRJIT_INLINE Value sin_tier(const Value &x) {
+    /* Total absolute error on [-8192, 8192]:
+        - fast::sin:   avg = 2.37e-08, max = 1.83e-07
+        - approx::sin: avg = 3.83e-07, max = 1.25e-06 */
+    using Scalar = scalar_t<Value>;
+    using IntArray = int_array_t<Value>;
+
+    // sin(x) = (-1)^j sin(y) with x = j Pi + y and y in [-Pi/2, Pi/2]
+    Value j = round(x * InvPi<Scalar>);
+
+    // Extended precision modular arithmetic
+    Value y = fnmadd(j, Scalar(3.140625), x);
+    y = fnmadd(j, Scalar(9.67502593994140625e-4), y);
+    y = fnmadd(j, Scalar(1.509957990978376432e-7), y);
+
+    return sin_tier_poly<Acc>(y, IntArray(j));
+}
+
+template <Accuracy Acc, typename Value>
+DRJIT_INLINE Value cos_tier(const Value &x) {
+    /* Total absolute error on [-8192, 8192]:
+        - fast::cos:   avg = 2.37e-08, max = 1.79e-07
+        - approx::cos: avg = 3.83e-07, max = 1.27e-06 */
+    using Scalar = scalar_t<Value>;
+    using IntArray = int_array_t<Value>;
+    using Int = scalar_t<IntArray>;
+
+    // cos(x) = (-1)^(m+1) sin(y) with x = (m + 1/2) Pi + y and y in [-Pi/2, Pi/2]
+    Value m = floor(x * InvPi<Scalar>),
+          k = m + Scalar(.5f);
+
+    // Extended precision modular arithmetic
+    Value y = fnmadd(k, Scalar(3.140625), x);
+    y = fnmadd(k, Scalar(9.67502593994140625e-4), y);
+    y = fnmadd(k, Scalar(1.509957990978376432e-7), y);
+
+    return sin_tier_poly<Acc>(y, IntArray(m) + Int(1));
+}
+
+NAMESPACE_END(detail)
+
+#define DRJIT_TIERED_UNARY(Acc, name, impl)                                    \
+    template <typename Value> Value name(const Value &x) {                     \
+        return detail::tiered<detail::Accuracy::Acc>(                          \
+            x, [](const auto &v) { return impl<detail::Accuracy::Acc>(v); },   \
+            [](const auto &v) { return drjit::name(v); });                     \
+    }
+
+#define DRJIT_TIERED_FUNCTIONS(Acc, ns)                                        \
+    DRJIT_TIERED_UNARY(Acc, exp, detail::exp_tier)                             \
+    DRJIT_TIERED_UNARY(Acc, exp2, detail::exp2_tier)                           \
+    DRJIT_TIERED_UNARY(Acc, sin, detail::sin_tier)                             \
+    DRJIT_TIERED_UNARY(Acc, cos, detail::cos_tier)                             \
+                                                                               \
+    template <typename Value> Value log(const Value &x) {                      \
+        return detail::tiered<detail::Accuracy::Acc>(                          \
+            x, [](const auto &v) {                                             \
+                return detail::log_tier<detail::Accuracy::Acc, false>(v);      \
+            }, [](const auto &v) { return drjit::log(v); });                   \
+    }                                                                          \
+                                                                               \
+    template <typename Value> Value log2(const Value &x) {                     \
+        return detail::tiered<detail::Accuracy::Acc>(                          \
+            x, [](const auto &v) {                                             \
+                return detail::log_tier<detail::Accuracy::Acc, true>(v);       \
+            }, [](const auto &v) { return drjit::log2(v); });                  \
+    }                                                                          \
+                                                                               \
+    template <typename Value> std::pair<Value, Value> sincos(const Value &x) { \
+        return { ns::sin(x), ns::cos(x) };                                     \
+    }
+
+/// Transcendental functions with a max. error of ~4 ulp in single precision
+NAMESPACE_BEGIN(fast)
+
+DRJIT_TIERED_FUNCTIONS(Fast, fast)
+
+NAMESPACE_END(fast)
+
+/// Transcendental functions with a max. relative error of ~1e-5
+NAMESPACE_BEGIN(approx)
+
+DRJIT_TIERED_FUNCTIONS(Approx, approx)
+
+NAMESPACE_END(approx)
+
+#undef DRJIT_TIERED_FUNCTIONS
+#undef DRJIT_TIERED_UNARY
+
+//! @}
+// -----------------------------------------------------------------------
+
 NAMESPACE_END(drjit)
@@ -0,0 +1,95 @@
+/*
+    drjit/matmul.h -- Cache-blocked dense matrix multiplication on the CPU
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include <drjit/dynamic.h>
+#include <drjit/jit.h>
+#include <drjit/extra.h>
+
+NAMESPACE_BEGIN(drjit)
+
+/**
+ * \brief Compute a batch of dense matrix products on the CPU
+ *
+ * This function computes ``batch`` matrix products ``C = op(A) @ op(B)``,
+ * where ``op(A)`` has shape ``m x k``, ``op(B)`` has shape ``k x n``, and the
+ * output ``C`` has shape ``m x n``. All matrices are stored in row-major
+ * order. When ``a_trans`` is set, ``A`` is stored as a ``k x m`` matrix and
+ * ``op(A)`` refers to its transpose (and similarly for ``b_trans``).
+ *
+ * The ``i``-th product reads its operands from ``a + i * a_batch_stride``
+ * and ``b + i * b_batch_stride`` and writes its output to ``c + i * m * n``.
+ * Set a batch stride to zero to broadcast an operand over the batch.
+ *
+ * The implementation packs tiles of the operands into contiguous buffers and
+ * accumulates the output in register-blocked micro-kernels that are
+ * vectorized using the widest instruction set supported by the CPU (see
+ * ``drjit/dispatch.h``). Larger products are parallelized over tiles of the
+ * output using the nanothread thread pool.
+ *
+ * The following ``Value`` types are currently supported:
+ *
+ * - ``float``
+ * - ``double``
+ */
+template <typename Value>
+DRJIT_EXTRA_EXPORT void
+matmul(uint32_t batch, uint32_t m, uint32_t n, uint32_t k, const Value *a,
+       size_t a_batch_stride, bool a_trans, const Value *b,
+       size_t b_batch_stride, bool b_trans, Value *c);
+
+/// Convenience wrapper around \ref matmul() for dynamic CPU arrays
+template <typename Scalar>
+DynamicArray<Scalar>
+matmul(uint32_t batch, uint32_t m, uint32_t n, uint32_t k,
+       const DynamicArray<Scalar> &a, size_t a_batch_stride, bool a_trans,
+       const DynamicArray<Scalar> &b, size_t b_batch_stride, bool b_trans) {
+    DynamicArray<Scalar> c =
+        empty<DynamicArray<Scalar>>((size_t) batch * m * n);
+    matmul(batch, m, n, k, a.data(), a_batch_stride, a_trans, b.data(),
+           b_batch_stride, b_trans, c.data());
+    return c;
+}
+
+#if defined(DRJIT_ENABLE_LLVM)
+/**
+ * \brief Convenience wrapper around \ref matmul() for LLVM arrays
+ *
+ * This function evaluates the operands, waits for pending kernels to finish,
+ * and then runs the blocked CPU implementation. The result is a new array
+ * that maps the output buffer. Note that this operation is not traced.
+ */
+template <typename Scalar>
+LLVMArray<Scalar>
+matmul(uint32_t batch, uint32_t m, uint32_t n, uint32_t k,
+       const LLVMArray<Scalar> &a, size_t a_batch_stride, bool a_trans,
+       const LLVMArray<Scalar> &b, size_t b_batch_stride, bool b_trans) {
+    size_t size = (size_t) batch * m * n;
+    if (size == 0)
+        return LLVMArray<Scalar>();
+    else if (k == 0)
+        return zeros<LLVMArray<Scalar>>(size);
+
+    const Scalar *a_ptr = a.data(), *b_ptr = b.data();
+    jit_sync_thread();
+
+    Scalar *c_ptr = (Scalar *) jit_malloc(AllocType::Host, size * sizeof(Scalar));
+    matmul(batch, m, n, k, a_ptr, a_batch_stride, a_trans, b_ptr,
+           b_batch_stride, b_trans, c_ptr);
+
+    return LLVMArray<Scalar>::map_(c_ptr, size, true);
+}
+#endif
+
+extern template DRJIT_EXTRA_EXPORT void matmul(uint32_t, uint32_t, uint32_t, uint32_t, const float *, size_t, bool, const float *, size_t, bool, float *);
+extern template DRJIT_EXTRA_EXPORT void matmul(uint32_t, uint32_t, uint32_t, uint32_t, const double *, size_t, bool, const double *, size_t, bool, double *);
+
+NAMESPACE_END(drjit)
@@ -247,6 +247,10 @@ struct ArraySupplement : ArrayMeta {
 
     using TensorShape = vector<size_t> & (*) (ArrayBase *) noexcept;
     using TensorArray = PyObject * (*) (PyObject *) noexcept;
+    using TensorLayout = size_t (*) (const ArrayBase *, int64_t *) noexcept;
+    using TensorView = void (*) (const ArrayBase *, size_t, const size_t *,
+                                 const int64_t *, size_t, ArrayBase *);
+    using TensorMaterialize = void (*) (ArrayBase *);
     using BlockReduceOp = void (*)(const ArrayBase *, ReduceOp, uint32_t, int, ArrayBase *);
     using BlockPrefixReduceOp = void (*)(const ArrayBase *, ReduceOp, uint32_t, bool, bool, ArrayBase *);
 
@@ -329,6 +333,23 @@ struct ArraySupplement : ArrayMeta {
 
             /// Python type object for indexing calculations
             PyObject *tensor_index;
+
+            /// Query the strides and offset of a (possibly strided) tensor
+            TensorLayout tensor_layout;
+
+            /// Create a strided view referencing the storage of a tensor
+            TensorView tensor_view;
+
+            /// Return the storage of a tensor without materializing views
+            TensorArray tensor_storage;
+
+            /**
+             * Convert a strided view into a contiguous tensor in place. This
+             * must precede writes through ``tensor_shape`` and
+             * ``tensor_array``, which otherwise only return the shape and a
+             * temporary copy of the entries of a view.
+             */
+            TensorMaterialize tensor_materialize;
         };
     };
 
@@ -740,19 +761,58 @@ void bind_tensor(ArrayBinding &b) {
     namespace nb = nanobind;
 
     b.tensor_shape = (ArrayBinding::TensorShape) +[](T *o) noexcept -> vector<size_t> & {
-        return o->shape();
+        // Use the const accessor, which doesn't materialize views
+        return const_cast<vector<size_t> &>(((const T *) o)->shape());
     };
 
     b.tensor_array = (ArrayBinding::TensorArray) +[](PyObject *o) noexcept -> PyObject * {
-        T *inst = nanobind::inst_ptr<T>(o);
+        const T *inst = nanobind::inst_ptr<T>(o);
+        nanobind::detail::cleanup_list cleanup(o);
+        nb::handle result;
+
+        if (inst->is_contiguous()) {
+            result = nanobind::detail::make_caster<typename T::Array>::from_cpp(
+                inst->storage(), nanobind::rv_policy::reference_internal,
+                &cleanup);
+        } else {
+            // Gather the entries of views without modifying the tensor
+            result = nanobind::detail::make_caster<typename T::Array>::from_cpp(
+                inst->array(), nanobind::rv_policy::move, &cleanup);
+        }
+
+        assert(!cleanup.used());
+        return result.ptr();
+    };
+
+    b.tensor_layout = (ArrayBinding::TensorLayout) +[](const T *o, int64_t *strides) noexcept -> size_t {
+        typename T::Strides s = o->strides();
+        for (size_t i = 0; i < s.size(); ++i)
+            strides[i] = s[i];
+        return o->offset();
+    };
+
+    b.tensor_view = (ArrayBinding::TensorView) +[](const T *o, size_t ndim,
+                                                   const size_t *shape,
+                                                   const int64_t *strides,
+                                                   size_t offset, T *out) {
+        new (out) T(o->storage(), typename T::Shape(shape, shape + ndim),
+                    typename T::Strides(strides, strides + ndim), offset);
+    };
+
+    b.tensor_storage = (ArrayBinding::TensorArray) +[](PyObject *o) noexcept -> PyObject * {
+        const T *inst = nanobind::inst_ptr<T>(o);
         nanobind::detail::cleanup_list cleanup(o);
         nb::handle result =
             nanobind::detail::make_caster<typename T::Array>::from_cpp(
-                inst->array(), nanobind::rv_policy::reference_internal,
+                inst->storage(), nanobind::rv_policy::reference_internal,
                 &cleanup);
         assert(!cleanup.used());
         return result.ptr();
     };
+
+    b.tensor_materialize = (ArrayBinding::TensorMaterialize) +[](T *o) {
+        o->materialize();
+    };
 }
 
 template <typename T> void bind_mask_reductions(ArrayBinding &b) {
@@ -113,7 +113,8 @@ public:
      *
      * When either the input or output array has more than 64K elements, the
      * implementation uses the nanothread thread pool to parallelize the
-     * resampling operation.
+     * resampling operation. The computation is vectorized using the widest
+     * instruction set supported by the CPU (see ``drjit/dispatch.h``).
      *
      * The following ``Value`` types are currently supported:
      *
@@ -137,6 +138,40 @@ public:
         return target;
     }
 
+    /**
+     * \brief Resample two adjacent axes of a memory buffer on the CPU
+     *
+     * This function is equivalent to resampling the horizontal axis with
+     * ``res_x`` followed by the vertical axis with ``res_y``. Here, ``source``
+     * is interpreted as a sequence of images with ``res_y.source_res()`` rows,
+     * ``res_x.source_res()`` columns, and ``channels`` interleaved channels.
+     *
+     * The fused implementation processes blocks of output rows and never
+     * stores the full-size intermediate result, which improves cache
+     * utilization and reduces memory usage. The function otherwise behaves
+     * like \ref resample() and supports the same ``Value`` types.
+     */
+    template <typename Value>
+    static void resample_2d(const Resampler &res_y, const Resampler &res_x,
+                            const Value *source, Value *target,
+                            uint32_t source_size, uint32_t channels);
+
+    /// Convenience wrapper around \ref resample_2d() for dynamic CPU arrays
+    template <typename Scalar>
+    static DynamicArray<Scalar>
+    resample_2d_fwd(const Resampler &res_y, const Resampler &res_x,
+                    const DynamicArray<Scalar> &source, uint32_t channels) {
+        uint32_t source_size = (uint32_t) source.size(),
+                 n_passes = source_size / (res_y.source_res() *
+                                           res_x.source_res() * channels),
+                 target_size = n_passes * res_y.target_res() *
+                               res_x.target_res() * channels;
+        DynamicArray<Scalar> target = empty<DynamicArray<Scalar>>(target_size);
+        resample_2d(res_y, res_x, source.data(), target.data(), source_size,
+                    channels);
+        return target;
+    }
+
     /**
      * \brief Resample a JIT-compiled (CUDA/LLVM) array
      *
@@ -168,6 +203,10 @@ extern template DRJIT_EXTRA_EXPORT void Resampler::resample(const uint8_t *, uin
 extern template DRJIT_EXTRA_EXPORT void Resampler::resample(const half *, half *, uint32_t, uint32_t) const;
 extern template DRJIT_EXTRA_EXPORT void Resampler::resample(const float *, float *, uint32_t, uint32_t) const;
 extern template DRJIT_EXTRA_EXPORT void Resampler::resample(const double *, double *, uint32_t, uint32_t) const;
+extern template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const uint8_t *, uint8_t *, uint32_t, uint32_t);
+extern template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const half *, half *, uint32_t, uint32_t);
+extern template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const float *, float *, uint32_t, uint32_t);
+extern template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const double *, double *, uint32_t, uint32_t);
 
 #if defined(DRJIT_ENABLE_CUDA)
 extern template DRJIT_EXTRA_EXPORT CUDAArray<half> Resampler::resample_fwd(const CUDAArray<half> &, uint32_t) const;
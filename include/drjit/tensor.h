@@ -21,23 +21,20 @@ template <typename Index, typename T>
 void tensor_broadcast_impl(const char *op, T &t, const vector<size_t> &shape) {
     DRJIT_MARK_USED(op);
     int ndim = (int) t.ndim();
-    if (ndim == 0 || memcmp(t.shape().data(), shape.data(), sizeof(size_t) * ndim) == 0)
+    // Query the shape via the const accessor, which doesn't materialize views
+    const vector<size_t> &t_shape = static_cast<const T &>(t).shape();
+    if (ndim == 0 || memcmp(t_shape.data(), shape.data(), sizeof(size_t) * ndim) == 0)
         return;
 
-    uint32_t size = 1;
-    for (int i = 0; i < ndim; ++i)
-        size *= (uint32_t) shape[i];
-
-    Index index = arange<Index>(size);
-
+    // Broadcast by setting the stride of expanded axes to zero. This
+    // produces a view that is materialized with a single gather
+    typename T::Strides strides = t.strides();
     for (int i = 0; i < ndim; ++i) {
-        uint32_t size_next = size / (uint32_t) shape[i];
         if (t.shape(i) == 1 && shape[i] != 1)
-            index = (index % size_next) + (index / size) * size_next;
-        size = size_next;
+            strides[i] = 0;
     }
 
-    t = T(gather<typename T::Array>(t.array(), index), shape);
+    t = T(t.storage(), shape, strides, t.offset());
 }
 
 template <typename T0, typename T1>
@@ -120,6 +117,7 @@ struct Tensor
     using ArrayType = Tensor<array_t<Array>>;
     using MaskType  = Tensor<mask_t<Array>>;
     using Shape     = vector<size_t>;
+    using Strides   = vector<int64_t>;
 
     static constexpr bool IsMask = is_mask_v<Array_>;
     static constexpr bool IsTensor = true;
@@ -137,11 +135,11 @@ struct Tensor
     DRJIT_ARRAY_IMPORT(Tensor, Base)
 
     template <typename T2>
-    Tensor(const Tensor<T2> &t2) : m_array(t2.m_array), m_shape(t2.m_shape) { }
+    Tensor(const Tensor<T2> &t2) : m_array(t2.array()), m_shape(t2.m_shape) { }
 
     template <typename T2>
     Tensor(const Tensor<T2> &t2, detail::reinterpret_flag)
-        : m_array(t2.m_array, detail::reinterpret_flag()), m_shape(t2.m_shape) { }
+        : m_array(t2.array(), detail::reinterpret_flag()), m_shape(t2.m_shape) { }
 
     Tensor(const Array &data) : m_array(data) {
         size_t size = m_array.size();
@@ -190,72 +188,136 @@ struct Tensor
     template <typename T, enable_if_t<drjit::detail::is_scalar_v<T> && !std::is_pointer_v<T>> = 0>
     Tensor(T value) : m_array(value) { }
 
-    operator Array() const { return m_array; }
+    /**
+     * \brief Create a strided view of the array \c storage
+     *
+     * Entry <tt>(i_0, ..., i_{n-1})</tt> of the resulting tensor refers to
+     * <tt>storage[offset + i_0 * strides[0] + ... + i_{n-1} * strides[n-1]]</tt>.
+     * Strides may be zero (broadcasting) or negative (reversal).
+     *
+     * Views share the storage of the tensor they were created from, and
+     * further views of a view directly index the original storage. Their
+     * entries are copied into a contiguous array (using a single gather
+     * operation, whose index computation is then part of the gather) only
+     * once this is required, e.g., when \ref array() is called or an
+     * arithmetic operation involves the tensor. Because arrays have value
+     * semantics, later modifications of the source tensor don't propagate to
+     * views (and vice versa).
+     *
+     * Const accessors return the gathered entries without storing them in
+     * the view, since the gather depends on the context in which it was
+     * performed (e.g., a symbolic loop body, or a region where gradient
+     * tracking is suspended). Only non-const accessors that hand out
+     * references to the internal state (\ref materialize(), non-const \ref
+     * array(), and non-const \ref shape()) convert the view in place.
+     */
+    Tensor(const Array &storage, const Shape &shape, const Strides &strides,
+           size_t offset)
+        : m_array(storage), m_shape(shape) {
+        size_t ndim = shape.size(), size = 1;
+        if (strides.size() != ndim)
+            drjit_raise("Tensor(): 'shape' and 'strides' must have the same "
+                        "size (%zu vs %zu)!", ndim, strides.size());
+
+        int64_t lo = (int64_t) offset, hi = (int64_t) offset,
+                expected = 1;
+        bool contiguous = offset == 0;
+        for (size_t i = ndim; i-- > 0; ) {
+            size *= shape[i];
+            int64_t extent = (int64_t) (shape[i] - 1) * strides[i];
+            (extent < 0 ? lo : hi) += extent;
+            contiguous &= shape[i] == 1 || strides[i] == expected;
+            expected *= (int64_t) shape[i];
+        }
+
+        if (size == 0) {
+            m_array = Array();
+            return;
+        }
+
+        if (lo < 0 || hi >= (int64_t) m_array.size())
+            drjit_raise("Tensor(): the view references entries [%lld, %lld], "
+                        "which are out of bounds for an array of size %zu!",
+                        (long long) lo, (long long) hi, m_array.size());
+
+        if (!contiguous || size != m_array.size()) {
+            if (ndim == 0) {
+                // A 0-dimensional view can't be distinguished from a
+                // contiguous tensor. Fetch the referenced entry right away.
+                m_array = gather<Array>(m_array, Index((uint32_t) offset));
+            } else {
+                m_strides = strides;
+                m_offset = offset;
+            }
+        }
+    }
+
+    operator Array() const { return array(); }
 
     Tensor add_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         auto shape = detail::tensor_broadcast("add_", t0, t1);
-        return Tensor(t0.m_array + t1.m_array, std::move(shape));
+        return Tensor(t0.array() + t1.array(), std::move(shape));
     }
 
     Tensor sub_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         auto shape = detail::tensor_broadcast("sub_", t0, t1);
-        return Tensor(t0.m_array - t1.m_array, std::move(shape));
+        return Tensor(t0.array() - t1.array(), std::move(shape));
     }
 
     Tensor mul_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("mul_", t0, t1);
-        return Tensor(t0.m_array * t1.m_array, std::move(shape));
+        return Tensor(t0.array() * t1.array(), std::move(shape));
     }
 
     Tensor mul_hi_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("mul_hi_", t0, t1);
-        return Tensor(mul_hi(t0.m_array, t1.m_array), std::move(shape));
+        return Tensor(mul_hi(t0.array(), t1.array()), std::move(shape));
     }
 
     Tensor div_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("div_", t0, t1);
-        return Tensor(t0.m_array / t1.m_array, std::move(shape));
+        return Tensor(t0.array() / t1.array(), std::move(shape));
     }
 
     Tensor mod_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("mod_", t0, t1);
-        return Tensor(t0.m_array % t1.m_array, std::move(shape));
+        return Tensor(t0.array() % t1.array(), std::move(shape));
     }
 
     Tensor or_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("or_", t0, t1);
-        return Tensor(t0.m_array | t1.m_array, std::move(shape));
+        return Tensor(t0.array() | t1.array(), std::move(shape));
     }
 
     Tensor and_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("and_", t0, t1);
-        return Tensor(t0.m_array & t1.m_array, std::move(shape));
+        return Tensor(t0.array() & t1.array(), std::move(shape));
     }
 
     Tensor andnot_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("andnot_", t0, t1);
-        return Tensor(andnot(t0.m_array, t1.m_array), std::move(shape));
+        return Tensor(andnot(t0.array(), t1.array()), std::move(shape));
     }
 
     Tensor xor_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("xor_", t0, t1);
-        return Tensor(t0.m_array ^ t1.m_array, std::move(shape));
+        return Tensor(t0.array() ^ t1.array(), std::move(shape));
     }
 
     Tensor fmadd_(const Tensor &b, const Tensor &c) const {
         Tensor t0 = *this, t1 = b, t2 = c;
         Shape shape = detail::tensor_broadcast("fmadd_", t0, t1, t2);
-        return Tensor(fmadd(t0.m_array, t1.m_array, t2.m_array), std::move(shape));
+        return Tensor(fmadd(t0.array(), t1.array(), t2.array()), std::move(shape));
     }
 
     Tensor fmsub_(const Tensor &b, const Tensor &c) const {
@@ -270,60 +332,60 @@ struct Tensor
         return fmadd_(-b, -c);
     }
 
-    Tensor abs_() const { return Tensor(abs(m_array), m_shape); }
+    Tensor abs_() const { return Tensor(abs(array()), m_shape); }
 
     Tensor minimum_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("minimum_", t0, t1);
-        return Tensor(drjit::minimum(t0.m_array, t1.m_array), std::move(shape));
+        return Tensor(drjit::minimum(t0.array(), t1.array()), std::move(shape));
     }
 
     Tensor maximum_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("maximum_", t0, t1);
-        return Tensor(drjit::maximum(t0.m_array, t1.m_array), std::move(shape));
+        return Tensor(drjit::maximum(t0.array(), t1.array()), std::move(shape));
     }
 
     auto gt_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("gt_", t0, t1);
-        return mask_t<Tensor>(t0.m_array > t1.m_array, std::move(shape));
+        return mask_t<Tensor>(t0.array() > t1.array(), std::move(shape));
     }
 
     auto ge_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("ge_", t0, t1);
-        return mask_t<Tensor>(t0.m_array >= t1.m_array, std::move(shape));
+        return mask_t<Tensor>(t0.array() >= t1.array(), std::move(shape));
     }
 
     auto lt_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("lt_", t0, t1);
-        return mask_t<Tensor>(t0.m_array < t1.m_array, std::move(shape));
+        return mask_t<Tensor>(t0.array() < t1.array(), std::move(shape));
     }
 
     auto le_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("le_", t0, t1);
-        return mask_t<Tensor>(t0.m_array <= t1.m_array, std::move(shape));
+        return mask_t<Tensor>(t0.array() <= t1.array(), std::move(shape));
     }
 
     auto eq_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("eq_", t0, t1);
-        return mask_t<Tensor>(eq(t0.m_array, t1.m_array), std::move(shape));
+        return mask_t<Tensor>(eq(t0.array(), t1.array()), std::move(shape));
     }
 
     auto neq_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("neq_", t0, t1);
-        return mask_t<Tensor>(neq(t0.m_array, t1.m_array), std::move(shape));
+        return mask_t<Tensor>(neq(t0.array(), t1.array()), std::move(shape));
     }
 
-    Tensor neg_() const { return Tensor(-m_array, m_shape); }
-    Tensor not_() const { return Tensor(~m_array, m_shape); }
+    Tensor neg_() const { return Tensor(-array(), m_shape); }
+    Tensor not_() const { return Tensor(~array(), m_shape); }
 
-    #define F(op) Tensor op##_() const { return Tensor(op(m_array), m_shape); }
+    #define F(op) Tensor op##_() const { return Tensor(op(array()), m_shape); }
     F(rcp) F(sqrt) F(rsqrt) F(sin) F(cos) F(tan) F(csc) F(sec) F(cot) F(asin)
     F(acos) F(atan) F(exp) F(exp2) F(log) F(log2) F(cbrt) F(erf) F(erfinv)
     F(lgamma) F(tgamma) F(sinh) F(cosh) F(tanh) F(csch) F(sech) F(coth) F(asinh)
@@ -332,23 +394,23 @@ struct Tensor
 
     template <int Imm> Tensor sl_() const { return sl_(Imm); }
     template <int Imm> Tensor sr_() const { return sr_(Imm); }
-    Tensor sl_(const Tensor &b) const { return Tensor(m_array.sl_(b.m_array), m_shape); }
-    Tensor sr_(const Tensor &b) const { return Tensor(m_array.sr_(b.m_array), m_shape); }
+    Tensor sl_(const Tensor &b) const { return Tensor(array().sl_(b.array()), m_shape); }
+    Tensor sr_(const Tensor &b) const { return Tensor(array().sr_(b.array()), m_shape); }
 
     std::pair<Tensor, Tensor> sincos_() const {
-        auto [s, c] = sincos(m_array);
+        auto [s, c] = sincos(array());
         return { Tensor(std::move(s), m_shape),  Tensor(std::move(c), m_shape) };
     }
 
     std::pair<Tensor, Tensor> sincosh_() const {
-        auto [s, c] = sincosh(m_array);
+        auto [s, c] = sincosh(array());
         return { Tensor(std::move(s), m_shape),  Tensor(std::move(c), m_shape) };
     }
 
     Tensor atan2_(const Tensor &b) const {
         Tensor t0 = *this, t1 = b;
         Shape shape = detail::tensor_broadcast("atan2_", t0, t1);
-        return Tensor(drjit::atan2(t0.m_array, t1.m_array), std::move(shape));
+        return Tensor(drjit::atan2(t0.array(), t1.array()), std::move(shape));
     }
 
     template <typename Mask>
@@ -357,7 +419,7 @@ struct Tensor
         Tensor t_ = t, f_ = f;
         Mask m_ = m;
         Shape shape = detail::tensor_broadcast("select_", m_, t_, f_);
-        return Tensor(select(m_.m_array, t_.m_array, f_.m_array), shape);
+        return Tensor(select(m_.array(), t_.array(), f_.array()), shape);
     }
 
     static Tensor zero_(size_t size) {
@@ -365,24 +427,193 @@ struct Tensor
     }
 
     size_t ndim() const { return m_shape.size(); }
-    size_t size() const { return m_array.size(); }
+    size_t size() const {
+        if (m_strides.empty())
+            return m_array.size();
+        size_t size = 1;
+        for (size_t s : m_shape)
+            size *= s;
+        return size;
+    }
     size_t shape(size_t i) const {
         if (i >= m_shape.size())
             drjit_fail("Tensor::shape(%zu): out of bounds!", i);
         return m_shape[i];
     }
 
-    Array &array() { return m_array; }
-    const Array &array() const { return m_array; }
-    Shape &shape() { return m_shape; }
+    /// Return the flat array representation (converts views in place)
+    Array &array() { materialize(); return m_array; }
+
+    /// Return the flat array representation (gathers the entries of views)
+    Array array() const {
+        if (m_strides.empty())
+            return m_array;
+        return materialize_();
+    }
+
+    /// Return a mutable reference to the shape (converts views in place)
+    Shape &shape() { materialize(); return m_shape; }
     const Shape &shape() const { return m_shape; }
 
-    const Value *data() const { return m_array.data(); }
-    Value *data() { return m_array.data(); }
+    const Value *data() const {
+        if (!m_strides.empty())
+            drjit_raise("Tensor::data(): strided views must be converted into "
+                        "a contiguous tensor (e.g., via materialize()) before "
+                        "their storage can be accessed!");
+        return m_array.data();
+    }
+    Value *data() { return array().data(); }
+
+    // -----------------------------------------------------------------------
+    //! @{ \name Strided views
+    // -----------------------------------------------------------------------
+
+    /// Is the tensor stored contiguously in C (row-major) order?
+    bool is_contiguous() const { return m_strides.empty(); }
+
+    /// Convert a strided view into a contiguous tensor in place
+    void materialize() {
+        if (m_strides.empty())
+            return;
+        m_array = materialize_();
+        m_strides = Strides();
+        m_offset = 0;
+    }
+
+    /// Return the (possibly shared and larger) storage referenced by a view
+    const Array &storage() const { return m_array; }
+
+    /// Return the offset of the first entry within \ref storage()
+    size_t offset() const { return m_offset; }
+
+    /// Return the distance between adjacent entries along each axis
+    Strides strides() const {
+        if (!m_strides.empty())
+            return m_strides;
+        Strides result(m_shape.size(), 0);
+        int64_t stride = 1;
+        for (size_t i = m_shape.size(); i-- > 0; ) {
+            result[i] = stride;
+            stride *= (int64_t) m_shape[i];
+        }
+        return result;
+    }
+
+    /// Return a view with permuted axes. Axis \c i of the result is axis \c axes[i] of the input
+    Tensor transpose(const vector<size_t> &axes) const {
+        size_t ndim = m_shape.size();
+        if (axes.size() != ndim)
+            drjit_raise("Tensor::transpose(): expected %zu axes, got %zu!",
+                        ndim, axes.size());
+
+        Strides strides = this->strides(), strides_out(ndim, 0);
+        Shape shape_out(ndim, 0);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < ndim; ++i) {
+            size_t j = axes[i];
+            if (j >= ndim || j >= 64 || (seen & (1ull << j)))
+                drjit_raise("Tensor::transpose(): 'axes' must be a "
+                            "permutation of the tensor axes!");
+            seen |= 1ull << j;
+            shape_out[i] = m_shape[j];
+            strides_out[i] = strides[j];
+        }
+
+        return Tensor(m_array, shape_out, strides_out, m_offset);
+    }
+
+    /// Return a view of the entries <tt>start, start + step, ..</tt> (\c count in total) along \c axis
+    Tensor slice(size_t axis, size_t start, int64_t step, size_t count) const {
+        if (axis >= m_shape.size())
+            drjit_raise("Tensor::slice(): tensor axis is out of bounds!");
+        if (count > 0 && (start >= m_shape[axis] ||
+                          (int64_t) start + (int64_t) (count - 1) * step < 0 ||
+                          (int64_t) start + (int64_t) (count - 1) * step >=
+                              (int64_t) m_shape[axis]))
+            drjit_raise("Tensor::slice(): slice is out of bounds!");
+
+        Strides strides = this->strides();
+        Shape shape = m_shape;
+        int64_t offset = (int64_t) m_offset + (int64_t) start * strides[axis];
+        shape[axis] = count;
+        strides[axis] *= step;
+
+        return Tensor(m_array, shape, strides, count ? (size_t) offset : 0);
+    }
+
+    //! @}
+    // -----------------------------------------------------------------------
 
 protected:
+    /// Gather the entries of a strided view into a contiguous array
+    Array materialize_() const {
+        if (m_strides.size() != m_shape.size())
+            drjit_raise("Tensor: the shape of a strided view was modified "
+                        "without updating its strides!");
+
+        // Merge axes that can be traversed using a single stride
+        Shape shape;
+        Strides strides;
+        for (size_t i = 0; i < m_shape.size(); ++i) {
+            size_t n = m_shape[i];
+            if (n == 1)
+                continue;
+            if (!shape.empty() && strides.back() == m_strides[i] * (int64_t) n) {
+                shape.back() *= n;
+                strides.back() = m_strides[i];
+            } else {
+                shape.push_back(n);
+                strides.push_back(m_strides[i]);
+            }
+        }
+
+        // Compute the storage index of each entry (negative strides wrap around)
+        size_t size = this->size();
+        Index linear = arange<Index>(size),
+              index = full<Index>((uint32_t) m_offset, size);
+
+        for (size_t i = shape.size(); i-- > 0; ) {
+            Index next;
+            if (i > 0)
+                next = linear / (uint32_t) shape[i];
+
+            if (strides[i] != 0) {
+                Index pos = i > 0 ? linear - next * (uint32_t) shape[i] : linear;
+                index += pos * (uint32_t) strides[i];
+            }
+
+            linear = std::move(next);
+        }
+
+        /* The gather is a permutation when no two entries of the view
+           overlap, which enables a more efficient derivative. Check this by
+           visiting axes in order of increasing stride magnitude. */
+        bool permute = true;
+        int64_t extent = 0;
+        for (size_t k = 0; k < strides.size(); ++k) {
+            size_t j = k;
+            for (size_t i = k + 1; i < strides.size(); ++i) {
+                if (abs(strides[i]) < abs(strides[j]))
+                    j = i;
+            }
+            std::swap(strides[j], strides[k]);
+            std::swap(shape[j], shape[k]);
+
+            int64_t stride = abs(strides[k]);
+            permute &= stride > extent;
+            extent += stride * (int64_t) (shape[k] - 1);
+        }
+
+        return gather<Array>(m_array, index, true,
+                             permute ? ReduceMode::Permute : ReduceMode::Auto);
+    }
+
+    /* Views store the underlying storage in 'm_array' together with a
+       nonempty 'm_strides' array */
     Array m_array;
     Shape m_shape;
+    Strides m_strides;
+    size_t m_offset = 0;
 };
 
 /// Evaluate ``value[..., index, ...]`` (where index is at position 'axis')
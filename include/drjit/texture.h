@@ -16,6 +16,7 @@
 #include <drjit/dynamic.h>
 #include <drjit/idiv.h>
 #include <drjit/jit.h>
+#include <drjit/morton.h>
 #include <drjit/tensor.h>
 #include <drjit/util.h>
 #include <drjit/traversable_base.h>
@@ -38,6 +39,12 @@ enum class WrapMode : uint32_t {
     Mirror = 2  /// Mirrors the texture wrt. each edge
 };
 
+/// Memory layout of the texels of non-accelerated textures
+enum class TextureLayout : uint32_t {
+    RowMajor = 0, /// Conventional row-major (C-style) ordering
+    Tiled = 1     /// Row-major grid of tiles with Morton-ordered texels
+};
+
 /// Texture data type
 enum class CudaTextureFormat : uint32_t {
     Float32 = 0, /// Single precision storage format
@@ -63,6 +70,10 @@ public:
         DynamicArray<Storage_>, Storage_*>;
     using TensorXf = Tensor<Storage>;
 
+    /// Tile size used by \ref TextureLayout::Tiled (64 texels per tile)
+    static constexpr uint32_t TileLog2 = Dimension == 3 ? 2 : 3;
+    static constexpr uint32_t TileSize = 1u << TileLog2;
+
     #define DR_TEX_ALLOC_PACKET(name, size)                     \
         Packet _packet;                                         \
         Storage_* name;                                         \
@@ -100,12 +111,24 @@ public:
      * When evaluating the texture outside of its boundaries, the \c wrap_mode
      * defines the wrapping method. The default behavior is \ref WrapMode::Clamp,
      * which indefinitely extends the colors on the boundary along each dimension.
+     *
+     * The \c layout parameter specifies how texels are arranged in memory when
+     * the texture is evaluated without hardware acceleration. The default
+     * \ref TextureLayout::RowMajor stores them in the same order as the
+     * tensor representation. With \ref TextureLayout::Tiled, the texture is
+     * instead split into tiles of 8x8 (2D) or 4x4x4 (3D) texels that are each
+     * stored contiguously in Morton order. Texels that are close in space then
+     * tend to share cache lines, which speeds up incoherent lookups into large
+     * textures. The layout is an implementation detail that does not affect
+     * \ref tensor() or \ref value(). It is ignored by 1D textures, by the
+     * scalar backends, and by hardware-accelerated CUDA textures.
      */
     Texture(const size_t shape[Dimension], size_t channels,
             bool use_accel = true,
             FilterMode filter_mode = FilterMode::Linear,
-            WrapMode wrap_mode = WrapMode::Clamp) {
-        init(shape, channels, use_accel, filter_mode, wrap_mode);
+            WrapMode wrap_mode = WrapMode::Clamp,
+            TextureLayout layout = TextureLayout::RowMajor) {
+        init(shape, channels, use_accel, filter_mode, wrap_mode, layout);
     }
 
     /**
@@ -124,18 +147,19 @@ public:
      * differentiable even when migrated. The \ref value() and \ref tensor()
      * operations will perform a reverse migration in this case.
      *
-     * Both the \c filter_mode and \c wrap_mode have the same defaults and
-     * behaviors as for the previous constructor.
+     * The \c filter_mode, \c wrap_mode, and \c layout parameters have the
+     * same defaults and behaviors as for the previous constructor.
      */
     template <typename TensorT>
     Texture(TensorT &&tensor, bool use_accel = true, bool migrate = true,
             FilterMode filter_mode = FilterMode::Linear,
-            WrapMode wrap_mode = WrapMode::Clamp) {
+            WrapMode wrap_mode = WrapMode::Clamp,
+            TextureLayout layout = TextureLayout::RowMajor) {
         if (tensor.ndim() != Dimension + 1)
             jit_raise("Texture::Texture(): tensor dimension must equal "
                         "texture dimension plus one.");
         init(tensor.shape().data(), tensor.shape(Dimension), use_accel,
-             filter_mode, wrap_mode);
+             filter_mode, wrap_mode, layout);
         set_tensor(std::forward<TensorT>(tensor), migrate);
     }
 
@@ -150,10 +174,12 @@ public:
         m_value = std::move(other.m_value);
         m_unpadded_value = std::move(other.m_value);
         m_resolution_opaque = std::move(other.m_resolution_opaque);
+        m_tile_res_opaque = std::move(other.m_tile_res_opaque);
         for (size_t i = 0; i < Dimension; ++i)
             m_inv_resolution[i] = std::move(other.m_inv_resolution[i]);
         m_filter_mode = other.m_filter_mode;
         m_wrap_mode = other.m_wrap_mode;
+        m_layout = other.m_layout;
         m_use_accel = other.m_use_accel;
         m_migrated = other.m_migrated;
         m_tensor_dirty = other.m_tensor_dirty;
@@ -172,10 +198,12 @@ public:
         m_value = std::move(other.m_value);
         m_unpadded_value = std::move(other.m_unpadded_value);
         m_resolution_opaque = std::move(other.m_resolution_opaque);
+        m_tile_res_opaque = std::move(other.m_tile_res_opaque);
         for (size_t i = 0; i < Dimension; ++i)
             m_inv_resolution[i] = std::move(other.m_inv_resolution[i]);
         m_filter_mode = other.m_filter_mode;
         m_wrap_mode = other.m_wrap_mode;
+        m_layout = other.m_layout;
         m_use_accel = other.m_use_accel;
         m_migrated = other.m_migrated;
         m_tensor_dirty = other.m_tensor_dirty;
@@ -203,6 +231,7 @@ public:
 
     FilterMode filter_mode() const { return m_filter_mode; }
     WrapMode wrap_mode() const { return m_wrap_mode; }
+    TextureLayout layout() const { return m_layout; }
     bool migrated() const { return m_migrated; }
     bool use_accel() const { return m_use_accel; }
 
@@ -238,6 +267,15 @@ public:
                     "Texture::set_value(): unexpected array size (%zu vs %zu)!",
                     padded_value.size(), m_size);
 
+            if (m_layout == TextureLayout::Tiled) {
+                UInt32 idx = arange<UInt32>(m_size);
+                idx = fmadd(storage_index(idx / m_channels_storage),
+                            m_channels_storage, idx % m_channels_storage);
+                Storage tiled_value = zeros<Storage>(m_value.array().size());
+                scatter(tiled_value, padded_value, idx);
+                padded_value = tiled_value;
+            }
+
             // We can always re-compute the unpadded values from the padded
             // ones. However, if we systematically do that, users will not be
             // able to lookup gradients on the unpadded tensor (`tensor().grad`).
@@ -320,7 +358,7 @@ public:
 
         // Only update tensors & CUDA texture if shape changed
         init(tensor.shape().data(), tensor.shape(Dimension),
-             m_use_accel, m_filter_mode, m_wrap_mode, shape_changed);
+             m_use_accel, m_filter_mode, m_wrap_mode, m_layout, shape_changed);
 
         if constexpr (std::is_lvalue_reference_v<TensorT>)
             set_value(tensor.array(), migrate);
@@ -358,7 +396,7 @@ public:
             if (shape_changed)
                 init(m_unpadded_value.shape().data(),
                      m_unpadded_value.shape(Dimension), m_use_accel, m_filter_mode,
-                     m_wrap_mode, true);
+                     m_wrap_mode, m_layout, true);
             else
                 // Avoid unnecessary copy when working with `DynamicArray`
                 return;
@@ -369,7 +407,7 @@ public:
 
             init(m_unpadded_value.shape().data(),
                  m_unpadded_value.shape(Dimension), m_use_accel, m_filter_mode,
-                 m_wrap_mode, shape_changed);
+                 m_wrap_mode, m_layout, shape_changed);
 
             m_unpadded_value.array() = inbound_tensor;
         }
@@ -377,7 +415,8 @@ public:
         set_value(m_unpadded_value.array(), migrate);
     }
 
-    const Storage &value() const { return tensor().array(); }
+    // The texture's tensors are never strided views, hence storage() == array()
+    const Storage &value() const { return tensor().storage(); }
 
     /**
      * \brief Return the texture data as a tensor object
@@ -394,12 +433,15 @@ public:
                 // AD-enabled if the original data `m_value` is also AD-enabled.
                 resume_grad<Storage> ad_scope_guard;
 
-                if (m_channels != m_channels_storage) {
+                if (m_channels != m_channels_storage ||
+                    m_layout == TextureLayout::Tiled) {
                     UInt32 idx = arange<UInt32>(
                         (m_size * m_channels) / m_channels_storage
                     );
                     UInt32 pixels_idx = idx / m_channels;
                     UInt32 channel_idx = idx % m_channels;
+                    if (m_layout == TextureLayout::Tiled)
+                        pixels_idx = storage_index(pixels_idx);
                     idx = fmadd(pixels_idx, m_channels_storage, channel_idx);
                     Storage values = gather<Storage>(m_value.array(), idx);
 
@@ -1399,7 +1441,7 @@ public:
 
 protected:
     void init(const size_t *shape, size_t channels, bool use_accel,
-              FilterMode filter_mode, WrapMode wrap_mode,
+              FilterMode filter_mode, WrapMode wrap_mode, TextureLayout layout,
               bool init_tensor = true) {
         if (channels == 0)
             jit_raise("Texture::Texture(): must have at least 1 channel!");
@@ -1415,15 +1457,24 @@ protected:
             m_channels_storage = channels;
         }
 
+        // Tiling is only supported by the non-accelerated JIT code path
+        bool tiled = layout == TextureLayout::Tiled && Dimension > 1 &&
+                     is_jit_v<Storage_> && !(HasCudaTexture && use_accel);
+
         m_size = m_channels_storage;
+        size_t storage_size = m_channels_storage;
         size_t unpadded_size = m_channels;
         size_t tensor_shape[Dimension + 1]{};
         for (size_t i = 0; i < Dimension; ++i) {
-            tensor_shape[i] = shape[i];
+            // Tiled storage is padded to a multiple of the tile size
+            size_t tile_res = (shape[i] + TileSize - 1) / TileSize;
+            tensor_shape[i] = tiled ? tile_res * TileSize : shape[i];
             m_shape[i] = shape[i];
             m_resolution_opaque[Dimension - 1 - i] = opaque<UInt32>((uint32_t) shape[i]);
+            m_tile_res_opaque[Dimension - 1 - i] = opaque<UInt32>((uint32_t) tile_res);
             m_inv_resolution[Dimension - 1 - i] = divisor<int32_t>((int32_t) shape[i]);
             m_size *= shape[i];
+            storage_size *= tensor_shape[i];
             unpadded_size *= shape[i];
         }
         tensor_shape[Dimension] = m_channels_storage;
@@ -1432,11 +1483,12 @@ protected:
         m_use_accel = use_accel;
         m_filter_mode = filter_mode;
         m_wrap_mode = wrap_mode;
+        m_layout = tiled ? TextureLayout::Tiled : TextureLayout::RowMajor;
 
         if (init_tensor) {
             if constexpr (is_jit_v<Storage_>) {
                 m_value =
-                    TensorXf(empty<Storage>(m_size), Dimension + 1, tensor_shape);
+                    TensorXf(empty<Storage>(storage_size), Dimension + 1, tensor_shape);
                 m_unpadded_value =
                     TensorXf(empty<Storage>(unpadded_size), Dimension + 1, m_shape);
             } else {
@@ -1564,6 +1616,21 @@ private:
         );
 
         Index index;
+        if constexpr (Dimension > 1) {
+            if (m_layout == TextureLayout::Tiled) {
+                /* Row-major index of the tile, followed by the Morton code
+                   of the texel within the tile in the lower bits */
+                Index tile = sr<TileLog2>(Index(pos[Dimension - 1])), local = 0;
+                for (size_t i = Dimension - 1; i-- > 0;)
+                    tile = fmadd(tile, m_tile_res_opaque[i],
+                                 sr<TileLog2>(Index(pos[i])));
+                for (size_t i = 0; i < Dimension; ++i)
+                    local |= detail::scatter_bits<Dimension, Index, 2>(
+                                 Index(pos[i]) & (TileSize - 1)) << (uint32_t) i;
+                return sl<TileLog2 * Dimension>(tile) | local;
+            }
+        }
+
         if constexpr (Dimension == 1) {
             index = Index(pos.x());
         } else if constexpr (Dimension == 2) {
@@ -1578,6 +1645,18 @@ private:
         return index;
     }
 
+    /// Map row-major texel indices to their position in the texture storage
+    UInt32 storage_index(const UInt32 &texel) const {
+        Array<Int32, Dimension> pos;
+        UInt32 remainder = texel;
+        for (size_t i = 0; i < Dimension - 1; ++i) {
+            pos[i] = Int32(remainder % m_resolution_opaque[i]);
+            remainder /= m_resolution_opaque[i];
+        }
+        pos[Dimension - 1] = Int32(remainder);
+        return index(pos);
+    }
+
 private:
     void *m_handle = nullptr;
     size_t m_size = 0;                      /* Total size of array */
@@ -1591,10 +1670,13 @@ private:
 
     // Stored in this order: width, height, depth
     Array<UInt32, Dimension> m_resolution_opaque;
+    Array<UInt32, Dimension> m_tile_res_opaque; /* Number of tiles (tiled
+                                                   layout only) */
     divisor<int32_t> m_inv_resolution[Dimension] { };
 
     FilterMode m_filter_mode;
     WrapMode m_wrap_mode;
+    TextureLayout m_layout = TextureLayout::RowMajor;
     bool m_use_accel = false;
     mutable bool m_migrated = false;        /* CUDA backend flag to indicate
                                                whether texture data is
@@ -1614,7 +1696,7 @@ public:
             return;
 
         DRJIT_MAP(DR_TRAVERSE_MEMBER_RO, m_value, m_unpadded_value,
-                  m_resolution_opaque, m_inv_resolution);
+                  m_resolution_opaque, m_tile_res_opaque, m_inv_resolution);
         if constexpr (HasCudaTexture) {
             uint32_t n_textures = 1 + ((uint32_t(m_channels) - 1) / 4);
             std::vector<uint32_t> indices(n_textures);
@@ -1632,7 +1714,7 @@ public:
             return;
 
         DRJIT_MAP(DR_TRAVERSE_MEMBER_RW, m_value, m_unpadded_value,
-                  m_resolution_opaque, m_inv_resolution);
+                  m_resolution_opaque, m_tile_res_opaque, m_inv_resolution);
         if constexpr (HasCudaTexture) {
             uint32_t n_textures = 1 + ((uint32_t(m_channels) - 1) / 4);
             std::vector<uint32_t> indices(n_textures);
@@ -234,6 +234,104 @@ IndexN binary_search(typename std::enable_if_t<is_jit_v<Index1>, Index1> start_,
     return start;
 }
 
+/**
+ * \brief Reorder a sorted array into the Eytzinger (breadth-first) layout
+ * used by \ref searchsorted()
+ *
+ * The entries are arranged as the nodes of a complete binary search tree
+ * stored in breadth-first order, and padded with the largest value of the
+ * type (or infinity) so that the tree is perfectly balanced. The output thus
+ * has <tt>2^h - 1</tt> entries, where \c h is the number of bits needed to
+ * represent <tt>sorted.size()</tt>. The top levels of the tree occupy a small
+ * region at the beginning of the array that stays in the cache while many
+ * queries traverse the tree in parallel.
+ */
+template <typename Array> Array eytzinger(const Array &sorted) {
+    using UInt32 = uint32_array_t<Array>;
+    using Scalar = scalar_t<Array>;
+
+    uint32_t n = (uint32_t) sorted.size();
+    if (n == 0)
+        return Array();
+
+    uint32_t h = log2i(n) + 1,
+             size = (1u << h) - 1;
+
+    Scalar pad;
+    if constexpr (std::is_floating_point_v<Scalar>)
+        pad = Infinity<Scalar>;
+    else
+        pad = std::numeric_limits<Scalar>::max();
+
+    // Node 'k' (numbered from 1) at depth 'd' refers to the sorted entry
+    // '(2 * (k - 2^d) + 1) * 2^(h - d - 1) - 1'
+    UInt32 k = arange<UInt32>(1, size + 1),
+           d = log2i(k),
+           index = (((k - (UInt32(1) << d)) << 1) + 1) << (h - 1 - d);
+    index -= 1;
+
+    mask_t<UInt32> active = index < n;
+    return select(active, gather<Array>(sorted, index, active), pad);
+}
+
+/**
+ * \brief Find the indices where the entries of \c value should be inserted
+ * into the array \c sorted to maintain the order
+ *
+ * This function follows the conventions of <tt>numpy.searchsorted()</tt>:
+ * for each entry \c v of \c value, it returns the index of the first element
+ * of \c sorted such that <tt>v <= sorted[i]</tt> (or <tt>v < sorted[i]</tt>
+ * when \c right is \c true), or <tt>sorted.size()</tt> if there is no such
+ * element.
+ *
+ * In contrast to \ref binary_search(), the search is branch-free and takes the
+ * same, fixed number of steps for every entry, which are unrolled into
+ * straight-line code. When \c layout is specified, it must be the output of
+ * \ref eytzinger() for the array \c sorted, in which case the function
+ * traverses this more cache-friendly representation instead.
+ */
+template <typename Array>
+uint32_array_t<Array> searchsorted(const Array &sorted, const Array &value,
+                                   bool right = false,
+                                   const Array *layout = nullptr) {
+    using UInt32 = uint32_array_t<Array>;
+    using Mask = mask_t<Array>;
+
+    uint32_t n = (uint32_t) sorted.size();
+    if (n == 0)
+        return zeros<UInt32>(width(value));
+
+    auto pred = [&](const Array &a) -> Mask {
+        return right ? (a <= value) : (a < value);
+    };
+
+    if (layout) {
+        uint32_t h = log2i(n) + 1;
+        if (layout->size() != (1u << h) - 1)
+            drjit_raise("drjit::searchsorted(): the Eytzinger layout does not "
+                        "match the size of 'sorted'!");
+
+        // Descend the tree, the path encodes the number of smaller elements
+        UInt32 k(1);
+        for (uint32_t i = 0; i < h; ++i)
+            k = (k << 1) + select(pred(gather<Array>(*layout, k - 1)),
+                                  UInt32(1), UInt32(0));
+
+        return minimum(k - (1u << h), n);
+    }
+
+    UInt32 base(0);
+    for (uint32_t size = n; size > 1; ) {
+        uint32_t half = size >> 1;
+        base = select(pred(gather<Array>(sorted, base + (half - 1))),
+                      base + half, base);
+        size -= half;
+    }
+
+    return base + select(pred(gather<Array>(sorted, base)), UInt32(1),
+                         UInt32(0));
+}
+
 /// Vectorized N-dimensional 'range' iterable with automatic mask computation
 template <typename Value> struct range {
     static constexpr bool Recurse =
@@ -0,0 +1,55 @@
+# drjit_add_dispatch(<target> <source> [ISAS <isa>...])
+#
+# Compiles <source> once per instruction set and adds the resulting objects
+# to <target>, so that the kernels it defines can be selected at runtime
+# via CPUID (see include/drjit/dispatch.h). Supported instruction sets are
+# BASELINE, SSE42, AVX, AVX2, and AVX512 (default: all of them). On non-x86
+# platforms, only the BASELINE variant is compiled.
+#
+# For each compiled variant, the compile definition DRJIT_DISPATCH_HAS_<ISA>
+# is added to <target>, which enables the corresponding entry of tables
+# created with DRJIT_DISPATCH_DECLARE(). The flags of <target> should not
+# already enable a specific instruction set (e.g. via -march=native).
+
+function(drjit_add_dispatch TARGET SOURCE)
+  cmake_parse_arguments(PARSE_ARGV 2 ARG "" "" "ISAS")
+
+  if (NOT ARG_ISAS)
+    set(ARG_ISAS BASELINE SSE42 AVX AVX2 AVX512)
+  endif()
+
+  if (NOT CMAKE_SYSTEM_PROCESSOR MATCHES "(x86_64)|(AMD64)|(amd64)|(i[3-6]86)|(x86)")
+    set(ARG_ISAS BASELINE)
+  endif()
+
+  if (MSVC)
+    set(DRJIT_DISPATCH_FLAGS_SSE42  "")
+    set(DRJIT_DISPATCH_FLAGS_AVX    "/arch:AVX")
+    set(DRJIT_DISPATCH_FLAGS_AVX2   "/arch:AVX2")
+    set(DRJIT_DISPATCH_FLAGS_AVX512 "/arch:AVX512")
+    # MSVC does not expose SSE4.2 via preprocessor definitions
+    list(REMOVE_ITEM ARG_ISAS SSE42)
+  else()
+    set(DRJIT_DISPATCH_FLAGS_SSE42  "-msse4.2")
+    set(DRJIT_DISPATCH_FLAGS_AVX    "-mavx")
+    set(DRJIT_DISPATCH_FLAGS_AVX2   "-mavx2;-mfma;-mf16c;-mbmi;-mbmi2")
+    set(DRJIT_DISPATCH_FLAGS_AVX512 "-mavx512f;-mavx512cd;-mavx512vl;-mavx512dq;-mavx512bw;-mavx2;-mfma;-mf16c;-mbmi;-mbmi2")
+  endif()
+
+  get_filename_component(SOURCE_ABS ${SOURCE} ABSOLUTE)
+  get_filename_component(SOURCE_NAME ${SOURCE} NAME_WE)
+
+  foreach (ISA IN LISTS ARG_ISAS)
+    string(TOLOWER ${ISA} ISA_LOWER)
+    set(WRAPPER "${CMAKE_CURRENT_BINARY_DIR}/drjit_dispatch/${TARGET}_${SOURCE_NAME}_${ISA_LOWER}.cpp")
+
+    file(GENERATE OUTPUT ${WRAPPER} CONTENT
+      "// Generated by drjit_add_dispatch(), do not edit\n#define DRJIT_DISPATCH_ISA ${ISA}\n#include <drjit/dispatch.h>\n#include \"${SOURCE_ABS}\"\n")
+
+    target_sources(${TARGET} PRIVATE ${WRAPPER})
+    set_source_files_properties(${WRAPPER} PROPERTIES
+      COMPILE_OPTIONS "${DRJIT_DISPATCH_FLAGS_${ISA}}"
+      OBJECT_DEPENDS ${SOURCE_ABS})
+    target_compile_definitions(${TARGET} PRIVATE DRJIT_DISPATCH_HAS_${ISA}=1)
+  endforeach()
+endfunction()
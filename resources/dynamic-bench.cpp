@@ -0,0 +1,90 @@
+/*
+    dynamic-bench.cpp -- Throughput of element-wise arithmetic, copies, and
+    small allocations involving drjit::DynamicArray
+
+    Compile with
+
+    $ g++ dynamic-bench.cpp -std=c++17 -O3 -march=native -I../include \
+          -I../ext/drjit-core/include -o dynamic-bench
+
+    The element-wise benchmarks compare the packetized implementation in
+    drjit/dynamic.h against the generic per-element fallback of ArrayBaseT
+    that DynamicArray previously used for all arithmetic operations.
+*/
+
+#include <drjit/dynamic.h>
+#include <chrono>
+#include <cstdio>
+
+namespace dr = drjit;
+
+using FloatX = dr::DynamicArray<float>;
+using Base = FloatX::Base;
+
+template <typename Func> double time_ns(Func func, size_t reps) {
+    double best = 1e30;
+    for (int run = 0; run < 5; ++run) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < reps; ++i)
+            func();
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        best = std::min(best, ns / double(reps));
+    }
+    return best;
+}
+
+volatile float sink;
+
+void bench_arith(size_t n) {
+    size_t reps = std::max((size_t) 1, (size_t) (1 << 26) / n);
+    FloatX a = dr::arange<FloatX>(n), b = dr::full<FloatX>(2.f, n),
+           c = dr::full<FloatX>(1.f, n), s = FloatX(3.f);
+
+    #define BENCH(name, new_expr, old_expr)                                    \
+        {                                                                      \
+            double t_new = time_ns([&] { FloatX r = new_expr; sink = r[0]; },  \
+                                   reps),                                      \
+                   t_old = time_ns([&] { FloatX r = old_expr; sink = r[0]; },  \
+                                   reps);                                      \
+            printf("  n=%-8zu %-14s generic: %9.1f ns, packetized: %9.1f ns " \
+                   "(%.2fx)\n", n, name, t_old, t_new, t_old / t_new);         \
+        }
+
+    BENCH("a + b",       a + b,             a.Base::add_(b))
+    BENCH("a * scalar",  a * s,             a.Base::mul_(s))
+    BENCH("a / b",       a / b,             a.Base::div_(b))
+    BENCH("max(a, b)",   dr::maximum(a, b), a.Base::maximum_(b))
+    BENCH("fmadd(a,b,c)", dr::fmadd(a, b, c), a.Base::fmadd_(b, c))
+
+    #undef BENCH
+}
+
+void bench_memory(size_t n) {
+    size_t reps = std::max((size_t) 1, (size_t) (1 << 24) / n);
+    FloatX a = dr::arange<FloatX>(n);
+
+    double t_copy = time_ns([&] { FloatX r = a; sink = r[0]; }, reps),
+           t_move = time_ns([&] { FloatX r = a; FloatX q = std::move(r);
+                                  sink = q[0]; }, reps),
+           t_full = time_ns([&] { FloatX r = dr::full<FloatX>(1.f, n);
+                                  sink = r[0]; }, reps);
+
+    printf("  n=%-8zu copy: %8.1f ns, copy+move: %8.1f ns, full(): %8.1f ns\n",
+           n, t_copy, t_move, t_full);
+}
+
+int main() {
+    printf("Packet size: %zu, inline capacity: %zu elements\n\n",
+           dr::Packet<float>::Size, FloatX::SmallSize);
+
+    printf("Element-wise arithmetic:\n");
+    for (size_t n : { 1, 8, 64, 1024, 1 << 16, 1 << 22 })
+        bench_arith(n);
+
+    printf("\nCopies and allocation:\n");
+    for (size_t n : { 1, 8, 64, 1024, 1 << 16 })
+        bench_memory(n);
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+    math-bench.cpp -- Accuracy and throughput of the transcendental function
+    tiers in drjit/math.h (default, 'drjit::fast', and 'drjit::approx')
+
+    Compile with
+
+    $ g++ math-bench.cpp -std=c++17 -O3 -march=native -I../include \
+          -I../ext/drjit-core/include -o math-bench
+
+    Running './math-bench' prints the max./avg. error (relative error in
+    ulps, absolute error for sin/cos) on the domain listed next to each
+    function, followed by the throughput of a packetized evaluation. The
+    tiers of each function are timed in an interleaved fashion, which makes
+    their ratios robust to noise, but separate runs may still differ by a
+    few percent.
+*/
+
+#include <drjit/math.h>
+#include <drjit/packet.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace dr = drjit;
+
+using FloatP = dr::Packet<float>;
+
+struct Stats {
+    double max_err = 0, avg_err = 0, max_err_x = 0;
+};
+
+static float ulp(double ref) {
+    float r = std::abs((float) ref);
+    if (r == 0.f || !std::isfinite(r))
+        return std::numeric_limits<float>::denorm_min();
+    return std::nextafter(r, std::numeric_limits<float>::infinity()) - r;
+}
+
+template <typename Func, typename Ref>
+Stats accuracy(Func func, Ref ref, float a, float b, bool abs_err) {
+    const size_t n = 1 << 24;
+    Stats s;
+
+    for (size_t i = 0; i < n; i += FloatP::Size) {
+        FloatP x = dr::fmadd(dr::arange<FloatP>() + float(i),
+                             (b - a) / float(n - 1), a),
+               y = func(x);
+
+        for (size_t j = 0; j < FloatP::Size; ++j) {
+            double r = ref((double) x[j]),
+                   e = std::abs((double) y[j] - r);
+
+            if (!abs_err)
+                e /= ulp(r);
+            else if (!std::isfinite(r))
+                continue;
+
+            s.avg_err += e;
+            if (e > s.max_err) {
+                s.max_err = e;
+                s.max_err_x = x[j];
+            }
+        }
+    }
+
+    s.avg_err /= n;
+    return s;
+}
+
+/// Throughput of a single run in Gelem/s (small working set, stays in L1)
+template <typename Func>
+double throughput(Func func, const std::vector<float> &in,
+                  std::vector<float> &out) {
+    const size_t n = in.size(), reps = 2000;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < n; i += FloatP::Size)
+            dr::store(out.data() + i, func(dr::load<FloatP>(in.data() + i)));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double sec = std::chrono::duration<double>(t1 - t0).count();
+    return double(n) * double(reps) / sec * 1e-9;
+}
+
+template <typename F1, typename F2, typename F3, typename Ref>
+void bench(const char *name, F1 f_precise, F2 f_fast, F3 f_approx, Ref ref,
+           float a, float b, bool abs_err = false) {
+    const char *tiers[] = { "dr", "dr::fast", "dr::approx" };
+    // Time the tiers in an interleaved fashion and keep the best of many
+    // runs, so that frequency changes and other noise affect them equally
+    const size_t n = 1 << 10, runs = 200;
+    std::vector<float> in(n), out(n);
+    for (size_t i = 0; i < n; ++i)
+        in[i] = a + (b - a) * float(i) / float(n - 1);
+
+    double tp[3] = { 0, 0, 0 };
+    for (size_t k = 0; k < runs; ++k) {
+        tp[0] = std::max(tp[0], throughput(f_precise, in, out));
+        tp[1] = std::max(tp[1], throughput(f_fast, in, out));
+        tp[2] = std::max(tp[2], throughput(f_approx, in, out));
+    }
+
+    volatile float sink = out[n / 2];
+    (void) sink;
+
+    auto report = [&](int tier, auto func) {
+        Stats s = accuracy(func, ref, a, b, abs_err);
+
+        char label[64];
+        snprintf(label, sizeof(label), "%s::%s", tiers[tier], name);
+        if (abs_err)
+            printf("  %-18s [%g, %g]: max abs. err = %.3g (at x=%g), "
+                   "avg = %.3g, %6.2f Gelem/s (%.2fx)\n",
+                   label, a, b, s.max_err, s.max_err_x, s.avg_err, tp[tier],
+                   tp[tier] / tp[0]);
+        else
+            printf("  %-18s [%g, %g]: max = %.2f ulp (at x=%g), "
+                   "avg = %.3f ulp, %6.2f Gelem/s (%.2fx)\n",
+                   label, a, b, s.max_err, s.max_err_x, s.avg_err, tp[tier],
+                   tp[tier] / tp[0]);
+    };
+
+    report(0, f_precise);
+    report(1, f_fast);
+    report(2, f_approx);
+    printf("\n");
+}
+
+#define BENCH(name, ref, ...)                                                  \
+    bench(#name,                                                               \
+          [](const FloatP &x) DRJIT_INLINE_LAMBDA { return dr::name(x); },     \
+          [](const FloatP &x) DRJIT_INLINE_LAMBDA {                            \
+              return dr::fast::name(x);                                        \
+          },                                                                   \
+          [](const FloatP &x) DRJIT_INLINE_LAMBDA {                            \
+              return dr::approx::name(x);                                      \
+          },                                                                   \
+          [](double x) { return ref; }, __VA_ARGS__)
+
+int main() {
+    printf("Packet size: %zu\n\n", FloatP::Size);
+
+    BENCH(exp,  std::exp(x),  -20.f, 30.f);
+    BENCH(exp2, std::exp2(x), -20.f, 30.f);
+    BENCH(log,  std::log(x),  1e-20f, 1000.f);
+    BENCH(log2, std::log2(x), 1e-20f, 1000.f);
+    BENCH(sin,  std::sin(x),  -8192.f, 8192.f, true);
+    BENCH(cos,  std::cos(x),  -8192.f, 8192.f, true);
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+"""
+opt-bench.py -- Overhead of optimizer steps involving many parameters
+
+Run with
+
+$ python opt-bench.py
+
+Optimizers visit each registered parameter during ``Optimizer.step()``. This
+script registers many small tensors with an Adam optimizer and reports the
+time needed to trace and evaluate a step, with and without the fused mode
+(``Adam(..., fused=True)``) that updates all parameters using a single
+arena.
+"""
+
+import time
+import drjit as dr
+from drjit.opt import Adam
+from drjit.llvm.ad import TensorXf
+
+n_runs = 10
+
+
+def make_opt(count, fused):
+    opt = Adam(lr=1e-3, fused=fused)
+    for i in range(count):
+        opt[f'p{i}'] = dr.full(TensorXf, i, (16, 16))
+    return opt
+
+
+def step(opt):
+    for value in opt.values():
+        value.grad = dr.full(TensorXf, 1, value.shape)
+    opt.step()
+    dr.sync_thread()
+
+
+def bench(func):
+    best = float('inf')
+    for _ in range(n_runs + 1):
+        t0 = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+for count in (10, 100, 1000):
+    for fused in (False, True):
+        opt = make_opt(count, fused)
+        t = bench(lambda: step(opt))
+        print(f"  params={count:<5} fused={fused!s:<5} "
+              f"step: {t * 1e3:8.2f} ms, "
+              f"{t / count * 1e6:6.2f} us/param")
@@ -19,6 +19,25 @@ Float func_a = 1, func_b = 4; /// Target interval (6 for double, 4 for single pr
 Float func(Float x) {
     return log2_(erfc_(x)) / x;
 };
+#elif 0
+/* Reduced-accuracy tiers in 'drjit/math.h' ('drjit::fast', 'drjit::approx').
+   The exp2() fits were generated via
+
+   $ ./remez.sh -p 5 -q 0 -a    # fast::exp2
+   $ ./remez.sh -p 4 -q 0 -a    # approx::exp2
+
+   The remaining fits use the same flags with the following targets:
+
+   - exp(x) on [-log(2)/2, log(2)/2]: -p 5 (fast), -p 4 (approx)
+   - log(1+x)/x on [sqrt(1/2)-1, sqrt(2)-1]: -p 8 (fast), -p 5 (approx)
+   - sin(sqrt(x))/sqrt(x) on [0, (pi/2)^2]: -p 4 (fast), -p 3 (approx)
+   - atan(sqrt(x))/sqrt(x) on [0, 1]: -p 5 (approx) */
+
+Float func_a = -0.5, func_b = 0.5; /// Target interval
+
+Float func(Float x) {
+    return exp2_(x);
+};
 #else
 
 Float func_a = 0.001, func_b = 15;
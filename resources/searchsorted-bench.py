@@ -0,0 +1,55 @@
+"""
+searchsorted-bench.py -- Throughput of batched searches in sorted arrays
+in the LLVM backend
+
+Run with
+
+$ python searchsorted-bench.py
+
+The script compares ``dr.binary_search()``, which uses a symbolic loop, with
+the branch-free ``dr.searchsorted()`` operating on the sorted array and on
+its Eytzinger layout (``dr.eytzinger()``). It reports the number of queries
+processed per second for a range of table sizes.
+"""
+
+import time
+import drjit as dr
+from drjit.llvm import Float, PCG32
+
+n_runs = 5
+n_queries = 1 << 22
+
+
+def bench(func):
+    best = float('inf')
+    for _ in range(n_runs + 1):
+        t0 = time.perf_counter()
+        out = func()
+        dr.eval(out)
+        dr.sync_thread()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+def run(n):
+    rng = PCG32(n_queries)
+    table = dr.cumsum(dr.full(Float, 1, n))
+    query = rng.next_float32() * n
+    layout = dr.eytzinger(table)
+    dr.eval(table, query, layout)
+
+    t_binary = bench(lambda: dr.binary_search(
+        0, n, lambda i: dr.gather(Float, table, i) < query))
+    t_sorted = bench(lambda: dr.searchsorted(table, query))
+    t_layout = bench(lambda: dr.searchsorted(table, query, eytzinger=layout))
+
+    rate = lambda t: n_queries / t * 1e-6
+    print(f"  n=2^{n.bit_length() - 1:<3} "
+          f"binary_search: {rate(t_binary):8.1f} M/s, "
+          f"searchsorted: {rate(t_sorted):8.1f} M/s, "
+          f"eytzinger: {rate(t_layout):8.1f} M/s "
+          f"({t_binary / t_layout:.1f}x)")
+
+
+for i in range(10, 26, 2):
+    run(1 << i)
@@ -0,0 +1,80 @@
+"""
+texture-bench.py -- Lookup throughput of the row-major and tiled
+(``dr.TextureLayout.Tiled``) storage layouts of non-accelerated textures
+
+Run with
+
+$ python texture-bench.py [llvm|cuda]
+
+The script evaluates bilinear/trilinear and cubic lookups at random (i.e.,
+incoherent) positions and at positions sorted along a space-filling path
+(coherent) for a range of texture sizes, and prints the throughput of each
+layout along with the speedup of the tiled variant.
+"""
+
+import math
+import sys
+import time
+import drjit as dr
+
+backend = sys.argv[1] if len(sys.argv) > 1 else 'llvm'
+mod = getattr(dr, backend)
+
+n_lookups = 1 << 22
+n_runs = 5
+channels = 4
+
+
+def bench(tex, pos, method):
+    func = getattr(tex, method)
+    best = float('inf')
+    for _ in range(n_runs + 1):
+        out = func(pos)
+        dr.eval(pos)
+        dr.sync_thread()
+        t0 = time.perf_counter()
+        dr.eval(out)
+        dr.sync_thread()
+        best = min(best, time.perf_counter() - t0)
+    return n_lookups / best * 1e-6
+
+
+def run(dim, res):
+    Tex = getattr(mod.ad, f'Texture{dim}f')
+    Array = getattr(mod.ad, f'Array{dim}f')
+    PCG32 = getattr(mod.ad, 'PCG32')
+
+    shape = [res] * dim + [channels]
+    rng = PCG32(math.prod(shape))
+    tensor = mod.ad.TensorXf(rng.next_float32(), shape=shape)
+
+    rng = PCG32(n_lookups)
+    pos_random = Array([rng.next_float32() for _ in range(dim)])
+
+    # Coherent lookups: a small random jitter around a scanline order
+    bits = 22 // dim
+    idx = dr.arange(mod.ad.UInt32, n_lookups)
+    pos_coherent = Array([
+        dr.fmadd(rng.next_float32(), 4.0 / res,
+                 mod.ad.Float((idx >> (bits * i)) & ((1 << bits) - 1)) /
+                 (1 << bits))
+        for i in range(dim)
+    ])
+
+    for label, pos in (('random', pos_random), ('coherent', pos_coherent)):
+        for method in ('eval', 'eval_cubic'):
+            tp = []
+            for layout in (dr.TextureLayout.RowMajor, dr.TextureLayout.Tiled):
+                tex = Tex(tensor, use_accel=False, layout=layout)
+                tp.append(bench(tex, pos, method))
+            print(f'  {dim}D, res={res:5}, {label:8} {method:10}: '
+                  f'row-major = {tp[0]:8.1f} M/s, tiled = {tp[1]:8.1f} M/s '
+                  f'({tp[1] / tp[0]:.2f}x)')
+
+
+if __name__ == '__main__':
+    print(f'Backend: {backend}, {n_lookups} lookups, {channels} channels\n')
+    for res in (256, 1024, 4096):
+        run(2, res)
+    for res in (64, 256):
+        run(3, res)
@@ -0,0 +1,65 @@
+"""
+tracing-bench.py -- Tracing throughput of Python arithmetic on Dr.Jit arrays
+
+Run with
+
+$ python tracing-bench.py
+
+Each arithmetic operation performed in Python appends a node to the graph of
+the computation without evaluating it. When tracing programs with many small
+operations, the per-operation overhead of the Python bindings dominates. This
+script reports the number of traced operations per second for binary
+operations between arrays of the same type and between an array and a Python
+scalar, using both JIT arrays and differentiable (AD) arrays.
+"""
+
+import time
+import drjit as dr
+
+n_ops = 100000
+n_runs = 5
+
+
+def bench(func):
+    best = float('inf')
+    for _ in range(n_runs + 1):
+        t0 = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - t0)
+    return n_ops / best
+
+
+def array_array(x, y):
+    for _ in range(n_ops // 4):
+        z = x + y
+        z = z * y
+        z = z - x
+        z = z < y
+
+
+def array_scalar(x, y):
+    for _ in range(n_ops // 4):
+        z = x + 1.0
+        z = 2 * z
+        z = z - 0.5
+        z = z < 3
+
+
+def inplace_scalar(x, y):
+    z = type(x)(x)
+    for _ in range(n_ops // 2):
+        z += 1.0
+        z *= 0.5
+
+
+for Float in (dr.llvm.Float, dr.llvm.ad.Float):
+    x = dr.opaque(Float, 1, 1024)
+    y = dr.opaque(Float, 2, 1024)
+
+    if dr.is_diff_v(Float):
+        dr.enable_grad(x)
+
+    print(f"{Float.__module__}.{Float.__name__}:")
+    for func in (array_array, array_scalar, inplace_scalar):
+        rate = bench(lambda: func(x, y))
+        print(f"  {func.__name__:<15}: {rate * 1e-6:6.2f} M ops/s")
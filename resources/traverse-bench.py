@@ -0,0 +1,71 @@
+"""
+traverse-bench.py -- Overhead of PyTree traversal
+
+Run with
+
+$ python traverse-bench.py
+
+Many Dr.Jit operations (``dr.eval()``, ``dr.while_loop()``, ``dr.if_stmt()``,
+``dr.freeze()``, etc.) recursively traverse their inputs. This script builds
+large trees of nested data classes and ``DRJIT_STRUCT`` types and reports the
+time needed to traverse (``dr.detail.collect_indices()``) and to transform
+(``dr.detail.copy()``) them, normalized by the number of nodes.
+"""
+
+import time
+import drjit as dr
+from dataclasses import dataclass
+from drjit.llvm import Float, Array3f
+
+n_runs = 20
+
+
+@dataclass
+class Leaf:
+    x: Float
+    y: Array3f
+    scale: float
+
+
+class Struct:
+    DRJIT_STRUCT = { 'a': Leaf, 'b': Leaf, 'c': Float }
+
+    def __init__(self, a=None, b=None, c=None):
+        self.a, self.b, self.c = a, b, c
+
+
+@dataclass
+class Node:
+    left: object
+    right: object
+    value: Struct
+
+
+def make_leaf():
+    return Leaf(x=Float(1), y=Array3f(1, 2, 3), scale=1.0)
+
+
+def make_tree(depth):
+    value = Struct(make_leaf(), make_leaf(), Float(2))
+    if depth == 0:
+        return Node(None, None, value)
+    return Node(make_tree(depth - 1), make_tree(depth - 1), value)
+
+
+def bench(func):
+    best = float('inf')
+    for _ in range(n_runs + 1):
+        t0 = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+for depth in (4, 8, 12):
+    tree = make_tree(depth)
+    nodes = 2 ** (depth + 1) - 1
+    t_traverse = bench(lambda: dr.detail.collect_indices(tree))
+    t_transform = bench(lambda: dr.detail.copy(tree))
+    print(f"  depth={depth:<3} nodes={nodes:<6} "
+          f"traverse: {t_traverse / nodes * 1e6:6.2f} us/node, "
+          f"transform: {t_transform / nodes * 1e6:6.2f} us/node")
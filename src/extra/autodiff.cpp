@@ -451,6 +451,9 @@ struct State {
     /// Are memory leak warnings enabled?
     bool leak_warnings = true;
 
+    /// Use ReduceMode::Expand for cooperative vector gradients on the CPU?
+    bool coop_vec_expand = true;
+
     State() {
         variables.resize(1);
         edges.resize(1);
@@ -3751,6 +3754,9 @@ const char *ad_var_graphviz() {
 void ad_set_leak_warnings(int value) { state.leak_warnings = (bool) value; }
 int ad_leak_warnings() { return (int) state.leak_warnings; }
 
+void ad_set_coop_vec_expand(int value) { state.coop_vec_expand = (bool) value; }
+int ad_coop_vec_expand() { return (int) state.coop_vec_expand; }
+
 // ==========================================================================
 // Functionality to track implicit inputs of recorded computation
 // ==========================================================================
@@ -4291,22 +4297,104 @@ public:
             x_v->accum(result, x_v->size);
         }
 
+        // On the CPU, accumulating into the shared matrix/bias gradient
+        // from every lane causes heavy atomic contention
+        bool expand = m_backend == JitBackend::LLVM && state.coop_vec_expand;
+
         if (A_v) {
             uint32_t vec_a = jit_index(m_x),
                      vec_b = jit_index(grad.index());
             if (m_transpose)
                 std::swap(vec_a, vec_b);
 
-            A_v->grad = JitVar::steal(jit_coop_vec_outer_product_accum(
-                A_v->grad.index(), (uint32_t) jit_var_size(jit_index(m_A)), &m_A_descr,
-                vec_b, vec_a));
+            uint32_t size = (uint32_t) jit_var_size(jit_index(m_A));
+            if (expand && m_A_descr.layout == MatrixLayout::RowMajor)
+                A_v->grad = outer_product_expand(A_v->grad, size, vec_b, vec_a);
+            else
+                A_v->grad = JitVar::steal(jit_coop_vec_outer_product_accum(
+                    A_v->grad.index(), size, &m_A_descr, vec_b, vec_a));
         }
 
         if (b_v) {
-            b_v->grad = JitVar::steal(jit_coop_vec_accum(
-                b_v->grad.index(), (uint32_t) jit_var_size(jit_index(m_b)), m_b_descr.offset,
-                grad.index()));
+            uint32_t size = (uint32_t) jit_var_size(jit_index(m_b));
+            if (expand)
+                b_v->grad = accum_expand(b_v->grad, size, grad.index());
+            else
+                b_v->grad = JitVar::steal(jit_coop_vec_accum(
+                    b_v->grad.index(), size, m_b_descr.offset, grad.index()));
+        }
+    }
+
+    /**
+     * CPU version of ``jit_coop_vec_outer_product_accum()``: scatter-add the
+     * outer product of the cooperative vectors 'a' and 'b' into the matrix
+     * gradient 'target' using ``ReduceMode::Expand``. Each worker thread then
+     * accumulates into a private copy of the gradient, and the copies are
+     * reduced once the kernel finishes.
+     */
+    JitVar outer_product_expand(const JitVar &target, uint32_t size,
+                                uint32_t a, uint32_t b) const {
+        const MatrixDescr &d = m_A_descr;
+        JitIndex *a_i = (JitIndex *) alloca(sizeof(JitIndex) * d.rows),
+                 *b_i = (JitIndex *) alloca(sizeof(JitIndex) * d.cols);
+        jit_coop_vec_unpack(a, d.rows, a_i);
+        jit_coop_vec_unpack(b, d.cols, b_i);
+
+        std::vector<JitVar> av(d.rows), bv(d.cols);
+        for (uint32_t i = 0; i < d.rows; ++i)
+            av[i] = cast_to(JitVar::steal(a_i[i]), d.dtype);
+        for (uint32_t j = 0; j < d.cols; ++j)
+            bv[j] = cast_to(JitVar::steal(b_i[j]), d.dtype);
+
+        JitVar result = grad_target(target, d.dtype, size);
+        JitMask mask = JitMask::steal(jit_var_bool(m_backend, true));
+
+        for (uint32_t i = 0; i < d.rows; ++i) {
+            for (uint32_t j = 0; j < d.cols; ++j) {
+                JitVar offset = JitVar::steal(
+                    jit_var_u32(m_backend, d.offset + i * d.stride + j));
+                result = JitVar::steal(jit_var_scatter(
+                    result.index(), (av[i] * bv[j]).index(), offset.index(),
+                    mask.index(), ReduceOp::Add, ReduceMode::Expand));
+            }
         }
+
+        return result;
+    }
+
+    /// CPU version of ``jit_coop_vec_accum()`` (see ``outer_product_expand()``)
+    JitVar accum_expand(const JitVar &target, uint32_t size, uint32_t a) const {
+        uint32_t n = jit_coop_vec_length(a);
+        JitIndex *a_i = (JitIndex *) alloca(sizeof(JitIndex) * n);
+        jit_coop_vec_unpack(a, n, a_i);
+
+        JitVar result = grad_target(target, m_b_descr.dtype, size);
+        JitMask mask = JitMask::steal(jit_var_bool(m_backend, true));
+
+        for (uint32_t i = 0; i < n; ++i) {
+            JitVar value = cast_to(JitVar::steal(a_i[i]), m_b_descr.dtype),
+                   offset = JitVar::steal(
+                       jit_var_u32(m_backend, m_b_descr.offset + i));
+            result = JitVar::steal(jit_var_scatter(
+                result.index(), value.index(), offset.index(), mask.index(),
+                ReduceOp::Add, ReduceMode::Expand));
+        }
+
+        return result;
+    }
+
+    static JitVar cast_to(JitVar &&v, VarType vt) {
+        if ((VarType) jit_var_type(v.index()) == vt)
+            return std::move(v);
+        return JitVar::steal(jit_var_cast(v.index(), vt, 0));
+    }
+
+    /// Return 'target' resized to 'size', or a zero-valued array if it is unset
+    JitVar grad_target(const JitVar &target, VarType vt, uint32_t size) const {
+        JitVar result = target.valid() ? target : scalar(m_backend, vt, 0.0);
+        if (result.size() != size)
+            result.resize(size);
+        return result;
     }
 
     void set_output(JitBackend backend, Index index) {
@@ -4381,6 +4469,301 @@ uint64_t ad_coop_vec_matvec(uint64_t A_index, const MatrixDescr *A_descr,
     }
 }
 
+// ==========================================================================
+// Multiresolution hash grid encoding
+// ==========================================================================
+
+/// Primes used to hash grid vertices (the same as in tiny-cuda-nn)
+static const uint32_t hashgrid_primes[] = { 1u,          2654435761u,
+                                            805459861u,  3674653429u,
+                                            2097192037u, 1434869437u,
+                                            2165219737u };
+
+/**
+ * Evaluation state of a hash grid encoding. The primal evaluation and both
+ * derivative passes visit the same levels and voxel corners. This class
+ * (re-)computes the associated lookup indices and interpolation weights so
+ * that the AD graph does not need to store them.
+ */
+struct HashGrid {
+    JitBackend backend;
+    uint32_t n_features;
+    double pos_offset;
+    std::vector<JitVar> pos;
+    std::vector<HashGridLevel> levels;
+    JitMask active;
+
+    JitVar u32(uint32_t value) const {
+        return JitVar::steal(jit_var_u32(backend, value));
+    }
+
+    /// Does this level hash its vertices, or can it use a dense layout?
+    bool hashed(const HashGridLevel &l) const {
+        uint64_t stride = 1;
+        for (size_t i = 0; i < pos.size(); ++i) {
+            stride *= l.resolution;
+            if (stride > l.size)
+                return true;
+        }
+        return false;
+    }
+
+    /// Compute feature vector indices and weights of the corners of a level
+    void corners(const HashGridLevel &l, VarType type, JitVar *index,
+                 JitVar *weight) const {
+        size_t dim = pos.size();
+        VarType pos_type = jit_var_type(pos[0].index());
+        JitVar scale = scalar(backend, pos_type, l.scale),
+               offset = scalar(backend, pos_type, pos_offset),
+               one = scalar(backend, pos_type, 1.0);
+
+        std::vector<JitVar> p0(dim), w0(dim), w1(dim);
+        for (size_t d = 0; d < dim; ++d) {
+            JitVar p = dr::fmadd(pos[d], scale, offset);
+            JitVar p_floor = JitVar::steal(jit_var_floor(p.index()));
+            p0[d] = JitVar::steal(
+                jit_var_cast(p_floor.index(), VarType::UInt32, 0));
+            w1[d] = p - JitVar::steal(jit_var_cast(p0[d].index(), pos_type, 0));
+            w0[d] = one - w1[d];
+        }
+
+        bool hashed = this->hashed(l);
+
+        for (uint32_t c = 0; c < (1u << dim); ++c) {
+            JitVar w, idx;
+            uint32_t stride = 1;
+
+            for (size_t d = 0; d < dim; ++d) {
+                bool upper = (c >> d) & 1;
+                JitVar key = upper ? p0[d] + u32(1) : p0[d];
+                const JitVar &wd = upper ? w1[d] : w0[d];
+                w = d == 0 ? wd : w * wd;
+
+                if (hashed) {
+                    JitVar h = d == 0 ? key : key * u32(hashgrid_primes[d]);
+                    idx = d == 0 ? h
+                                 : JitVar::steal(jit_var_xor(idx.index(), h.index()));
+                } else {
+                    idx = d == 0 ? key : idx + key * u32(stride);
+                    stride *= l.resolution;
+                }
+            }
+
+            index[c] = u32(l.offset) +
+                       JitVar::steal(jit_var_mod(idx.index(), u32(l.size).index()));
+            weight[c] = pos_type == type
+                            ? w
+                            : JitVar::steal(jit_var_cast(w.index(), type, 0));
+        }
+    }
+
+    /// Gather the feature vectors at 'index' from 'source'
+    void gather(const JitVar &source, const JitVar &index, JitVar *out) const {
+        uint32_t n = n_features;
+        if (n > 1 && n % 2 == 0) {
+            uint32_t *tmp = (uint32_t *) alloca(sizeof(uint32_t) * n);
+            jit_var_gather_packet(n, source.index(), index.index(),
+                                  active.index(), tmp);
+            for (uint32_t k = 0; k < n; ++k)
+                out[k] = JitVar::steal(tmp[k]);
+        } else {
+            for (uint32_t k = 0; k < n; ++k) {
+                JitVar offset = n == 1 ? index : index * u32(n) + u32(k);
+                out[k] = JitVar::steal(jit_var_gather(
+                    source.index(), offset.index(), active.index()));
+            }
+        }
+    }
+
+    /// Scatter-add the feature vectors 'values' to 'index' in 'target'
+    JitVar scatter_add(const JitVar &target, const JitVar &index,
+                       const JitVar *values) const {
+        uint32_t n = n_features;
+        if (n > 1 && n % 2 == 0) {
+            uint32_t *tmp = (uint32_t *) alloca(sizeof(uint32_t) * n);
+            for (uint32_t k = 0; k < n; ++k)
+                tmp[k] = values[k].index();
+            return JitVar::steal(jit_var_scatter_packet(
+                n, target.index(), tmp, index.index(), active.index(),
+                ReduceOp::Add, ReduceMode::Auto));
+        } else {
+            JitVar result = target;
+            for (uint32_t k = 0; k < n; ++k) {
+                JitVar offset = n == 1 ? index : index * u32(n) + u32(k);
+                result = JitVar::steal(jit_var_scatter(
+                    result.index(), values[k].index(), offset.index(),
+                    active.index(), ReduceOp::Add, ReduceMode::Auto));
+            }
+            return result;
+        }
+    }
+
+    /// Interpolate the features stored in 'source' (one output per level and feature)
+    void eval(const JitVar &source, JitVar *out) const {
+        VarType type = jit_var_type(source.index());
+        size_t n_corners = (size_t) 1 << pos.size();
+        std::vector<JitVar> index(n_corners), weight(n_corners), v(n_features);
+
+        for (size_t l = 0; l < levels.size(); ++l) {
+            corners(levels[l], type, index.data(), weight.data());
+            JitVar *o = out + l * n_features;
+
+            for (size_t c = 0; c < n_corners; ++c) {
+                gather(source, index[c], v.data());
+                for (uint32_t k = 0; k < n_features; ++k)
+                    o[k] = c == 0 ? v[k] * weight[c]
+                                  : dr::fmadd(v[k], weight[c], o[k]);
+            }
+        }
+
+        for (size_t i = 0; i < levels.size() * n_features; ++i)
+            out[i] = JitVar::steal(jit_var_and(out[i].index(), active.index()));
+    }
+};
+
+/**
+ * The AD graph of a hash grid built from individual gathers contains a node
+ * per level, corner, and feature. This custom operation instead tracks the
+ * whole encoding using a single node. Its reverse-mode derivative recomputes
+ * the corner indices and weights and issues the scatters into the parameter
+ * gradient grouped by level, so that the 2^D updates of a voxel are adjacent.
+ */
+class HashGridEncode : public dr::detail::CustomOpBase {
+public:
+    HashGridEncode(HashGrid &&grid) : m_grid(std::move(grid)) { }
+
+    ~HashGridEncode() {
+        std::lock_guard<Lock> guard(state.lock);
+        for (ADIndex index : m_output_indices)
+            ad_var_dec_ref_int(index, state[index]);
+    }
+
+    void forward() override {
+        std::lock_guard<Lock> guard(state.lock);
+        const ADVariable *v = state[m_input_indices[0]];
+        if (!v->grad.valid())
+            return;
+
+        std::vector<JitVar> out(m_output_indices.size());
+        m_grid.eval(v->grad, out.data());
+
+        for (size_t i = 0; i < out.size(); ++i) {
+            ADVariable *v_ = state[m_output_indices[i]];
+            v_->accum(out[i], v_->size);
+        }
+    }
+
+    void backward() override {
+        std::lock_guard<Lock> guard(state.lock);
+        uint32_t n = m_grid.n_features;
+        size_t n_corners = (size_t) 1 << m_grid.pos.size();
+
+        ADVariable *source = state[m_input_indices[0]];
+        VarType type = (VarType) source->type;
+        JitVar zero = scalar(m_backend, type, 0.0);
+
+        std::vector<JitVar> grad(n), values(n),
+            index(n_corners), weight(n_corners);
+
+        for (size_t l = 0; l < m_grid.levels.size(); ++l) {
+            bool valid = false;
+            for (uint32_t k = 0; k < n; ++k) {
+                const JitVar &g = state[m_output_indices[l * n + k]]->grad;
+                grad[k] = g.valid() ? g : zero;
+                valid |= g.valid();
+            }
+
+            // Skip levels that don't receive a gradient
+            if (!valid)
+                continue;
+
+            JitVar &source_grad = source->grad;
+            if (!source_grad.valid())
+                source_grad = zero;
+            if (source_grad.size() != source->size)
+                source_grad.resize(source->size);
+
+            m_grid.corners(m_grid.levels[l], type, index.data(), weight.data());
+
+            for (size_t c = 0; c < n_corners; ++c) {
+                for (uint32_t k = 0; k < n; ++k)
+                    values[k] = grad[k] * weight[c];
+                source_grad = m_grid.scatter_add(source_grad, index[c],
+                                                 values.data());
+            }
+        }
+    }
+
+    void add_output(uint32_t index) {
+        add_index(m_backend, index, false);
+
+        std::lock_guard<Lock> guard(state.lock);
+        ad_var_inc_ref_int(index, state[index]);
+    }
+
+    const char *name() const override { return "hashgrid_encode"; }
+
+private:
+    HashGrid m_grid;
+};
+
+void ad_hashgrid_encode(Index data, uint32_t n_features, uint32_t dimension,
+                        const JitIndex *pos, double pos_offset,
+                        uint32_t n_levels, const HashGridLevel *levels,
+                        JitIndex active, Index *out) {
+    if (dimension == 0 ||
+        dimension > sizeof(hashgrid_primes) / sizeof(uint32_t))
+        ad_raise("ad_hashgrid_encode(): the dimension must be between 1 and "
+                 "%zu!", sizeof(hashgrid_primes) / sizeof(uint32_t));
+    if (n_features == 0)
+        ad_raise("ad_hashgrid_encode(): the number of features must be "
+                 "positive!");
+
+    JitBackend backend = jit_set_backend(jit_index(data)).backend;
+
+    HashGrid grid;
+    grid.backend = backend;
+    grid.n_features = n_features;
+    grid.pos_offset = pos_offset;
+    grid.levels.assign(levels, levels + n_levels);
+    for (uint32_t i = 0; i < dimension; ++i)
+        grid.pos.push_back(JitVar::borrow(pos[i]));
+    grid.active = active ? JitMask::borrow(active)
+                         : JitMask::steal(jit_var_bool(backend, true));
+
+    size_t n_out = (size_t) n_levels * n_features;
+    std::vector<JitVar> result(n_out);
+    grid.eval(JitVar::borrow(jit_index(data)), result.data());
+
+    ADIndex data_ad = ad_index(data);
+    const std::vector<Scope> &scopes = local_state.scopes;
+    if (!scopes.empty())
+        scopes.back().maybe_disable(data_ad);
+
+    if (!data_ad) {
+        for (size_t i = 0; i < n_out; ++i)
+            out[i] = result[i].release();
+        return;
+    }
+
+    {
+        // Track implicit dependencies & potentially remap variable IDs
+        std::lock_guard<Lock> guard(state.lock);
+        data = ad_var_memop_remap(data, true);
+    }
+
+    ref<HashGridEncode> op = new HashGridEncode(std::move(grid));
+    op->add_index(backend, ad_index(data), true);
+
+    for (size_t i = 0; i < n_out; ++i) {
+        out[i] = ad_var_new(result[i].index());
+        op->add_output(ad_index(out[i]));
+    }
+
+    if (!ad_custom_op(op.get()))
+        ad_raise("ad_hashgrid_encode(): could not create CustomOp!");
+}
+
 // ==========================================================================
 // Thread reordering functionality
 // ==========================================================================
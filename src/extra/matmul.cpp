@@ -0,0 +1,90 @@
+/*
+    matmul.cpp -- Cache-blocked dense matrix multiplication on the CPU
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <drjit/matmul.h>
+#include <drjit/dispatch.h>
+#include <nanothread/nanothread.h>
+#include "matmul_kernel.h"
+#include <algorithm>
+
+/// Packetized CPU kernel, compiled for several instruction sets
+DRJIT_DISPATCH_DECLARE(matmul_kernel, void(const MatmulKernel &))
+
+NAMESPACE_BEGIN(drjit)
+
+/// Number of output rows and columns per work unit of \ref matmul()
+static constexpr uint32_t MatmulBlockRows = 96;
+static constexpr uint32_t MatmulBlockCols = 256;
+
+template <typename Value>
+void matmul(uint32_t batch, uint32_t m, uint32_t n, uint32_t k,
+            const Value *a, size_t a_batch_stride, bool a_trans,
+            const Value *b, size_t b_batch_stride, bool b_trans, Value *c) {
+    struct Task {
+        MatmulKernel kernel;
+        uint32_t m, n;
+        uint32_t blocks_m, blocks_n;
+        size_t a_batch_stride, b_batch_stride;
+    };
+
+    // Each work unit computes one block of the output of one product
+    auto callback = [](uint32_t index, void *payload) {
+        const Task &t = *(const Task *) payload;
+        MatmulKernel kr = t.kernel;
+
+        uint32_t blocks = t.blocks_m * t.blocks_n,
+                 i = index / blocks,
+                 bi = (index % blocks) / t.blocks_n,
+                 bj = (index % blocks) % t.blocks_n;
+
+        kr.i_begin = bi * MatmulBlockRows;
+        kr.i_end = std::min(kr.i_begin + MatmulBlockRows, t.m);
+        kr.j_begin = bj * MatmulBlockCols;
+        kr.j_end = std::min(kr.j_begin + MatmulBlockCols, t.n);
+        kr.a = (const Value *) kr.a + (size_t) i * t.a_batch_stride;
+        kr.b = (const Value *) kr.b + (size_t) i * t.b_batch_stride;
+        kr.c = (Value *) kr.c + (size_t) i * t.m * t.n;
+
+        matmul_kernel(kr);
+    };
+
+    if (batch == 0 || m == 0 || n == 0)
+        return;
+
+    Task task {
+        MatmulKernel {
+            std::is_same_v<Value, float> ? MatmulType::Float32
+                                         : MatmulType::Float64,
+            0, 0, 0, 0, k,
+            a, a_trans ? 1 : (size_t) k, a_trans ? (size_t) m : 1,
+            b, b_trans ? 1 : (size_t) n, b_trans ? (size_t) k : 1,
+            c, n
+        },
+        m, n,
+        (m + MatmulBlockRows - 1) / MatmulBlockRows,
+        (n + MatmulBlockCols - 1) / MatmulBlockCols,
+        a_batch_stride, b_batch_stride
+    };
+
+    uint32_t size = batch * task.blocks_m * task.blocks_n;
+    double flops = 2.0 * batch * m * n * k;
+
+    if (size == 1 || flops < 1 << 22) {
+        for (uint32_t i = 0; i < size; ++i)
+            callback(i, &task);
+    } else {
+        task_submit_and_wait(nullptr, size, callback, &task);
+    }
+}
+
+template DRJIT_EXTRA_EXPORT void matmul(uint32_t, uint32_t, uint32_t, uint32_t, const float *, size_t, bool, const float *, size_t, bool, float *);
+template DRJIT_EXTRA_EXPORT void matmul(uint32_t, uint32_t, uint32_t, uint32_t, const double *, size_t, bool, const double *, size_t, bool, double *);
+
+NAMESPACE_END(drjit)
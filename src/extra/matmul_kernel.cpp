@@ -0,0 +1,197 @@
+/*
+    matmul_kernel.cpp -- Packetized CPU kernel for dense matrix products
+
+    This file is compiled once per instruction set via 'drjit_add_dispatch()'
+    and should not be built on its own. See matmul_kernel.h for a description
+    of the interface.
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <drjit/packet.h>
+#include "matmul_kernel.h"
+#include <algorithm>
+#include <vector>
+
+namespace dr = drjit;
+
+namespace DRJIT_DISPATCH_NS {
+
+/**
+ * The implementation follows the structure of GotoBLAS/BLIS: the inner
+ * dimension is processed in chunks of 'KC' entries. For each chunk, the
+ * referenced parts of A and B are copied ("packed") into buffers that store
+ * them in the order in which the micro-kernel reads them: slivers of 'MR'
+ * rows of A and 'NR' columns of B. The micro-kernel then accumulates an MR x
+ * NR tile of the output in registers.
+ */
+template <typename Value> struct Matmul {
+    using P = dr::Packet<Value>;
+    static constexpr uint32_t PS = (uint32_t) P::Size;
+
+    // Without SIMD, fall back to a 4x4 tile that fits into the scalar registers
+    static constexpr uint32_t NP = PS == 1 ? 4 : 2;
+    static constexpr uint32_t MR = PS == 1 ? 4 : 6;
+    static constexpr uint32_t NR = NP * PS;
+    static constexpr uint32_t KC = 256;
+
+    const MatmulKernel &k;
+    const Value *a, *b;
+    Value *c;
+
+    Matmul(const MatmulKernel &k)
+        : k(k), a((const Value *) k.a), b((const Value *) k.b),
+          c((Value *) k.c) { }
+
+    /// Pack rows [i0, i0 + mc) and columns [p0, p0 + kc) of A
+    void pack_a(Value *dst, uint32_t i0, uint32_t mc, uint32_t p0,
+                uint32_t kc) const {
+        size_t rs = k.a_row_stride, cs = k.a_col_stride;
+
+        for (uint32_t is = 0; is < mc; is += MR) {
+            uint32_t mr = std::min(MR, mc - is);
+            const Value *src = a + (size_t) (i0 + is) * rs + (size_t) p0 * cs;
+
+            for (uint32_t p = 0; p < kc; ++p) {
+                uint32_t i = 0;
+                for (; i < mr; ++i)
+                    dst[i] = src[i * rs];
+                for (; i < MR; ++i)
+                    dst[i] = 0;
+                src += cs;
+                dst += MR;
+            }
+        }
+    }
+
+    /// Pack rows [p0, p0 + kc) and columns [j0, j0 + nc) of B
+    void pack_b(Value *dst, uint32_t p0, uint32_t kc, uint32_t j0,
+                uint32_t nc) const {
+        size_t rs = k.b_row_stride, cs = k.b_col_stride;
+
+        for (uint32_t js = 0; js < nc; js += NR) {
+            uint32_t nr = std::min(NR, nc - js);
+            const Value *src = b + (size_t) p0 * rs + (size_t) (j0 + js) * cs;
+
+            for (uint32_t p = 0; p < kc; ++p) {
+                uint32_t j = 0;
+                if (cs == 1 && nr == NR) {
+                    for (; j < NR; j += PS)
+                        dr::store(dst + j, dr::load<P>(src + j));
+                } else {
+                    for (; j < nr; ++j)
+                        dst[j] = src[j * cs];
+                    for (; j < NR; ++j)
+                        dst[j] = 0;
+                }
+                src += rs;
+                dst += NR;
+            }
+        }
+    }
+
+    /// Compute an MR x NR tile from packed slivers of A and B
+    DRJIT_INLINE static void micro(uint32_t kc, const Value *pa,
+                                   const Value *pb, Value *out, size_t ldc,
+                                   bool accumulate) {
+        P acc[MR][NP];
+        for (uint32_t i = 0; i < MR; ++i)
+            for (uint32_t j = 0; j < NP; ++j)
+                acc[i][j] = P(Value(0));
+
+        for (uint32_t p = 0; p < kc; ++p) {
+            P bv[NP];
+            for (uint32_t j = 0; j < NP; ++j)
+                bv[j] = dr::load<P>(pb + j * PS);
+
+            for (uint32_t i = 0; i < MR; ++i) {
+                P av(pa[i]);
+                for (uint32_t j = 0; j < NP; ++j)
+                    acc[i][j] = dr::fmadd(av, bv[j], acc[i][j]);
+            }
+
+            pa += MR;
+            pb += NR;
+        }
+
+        for (uint32_t i = 0; i < MR; ++i) {
+            for (uint32_t j = 0; j < NP; ++j) {
+                Value *ptr = out + i * ldc + j * PS;
+                if (accumulate)
+                    acc[i][j] += dr::load<P>(ptr);
+                dr::store(ptr, acc[i][j]);
+            }
+        }
+    }
+
+    void eval() {
+        uint32_t mc = k.i_end - k.i_begin, nc = k.j_end - k.j_begin;
+        size_t ldc = k.c_row_stride;
+
+        if (k.k == 0) {
+            for (uint32_t i = 0; i < mc; ++i)
+                for (uint32_t j = 0; j < nc; ++j)
+                    c[(k.i_begin + i) * ldc + k.j_begin + j] = 0;
+            return;
+        }
+
+        thread_local std::vector<Value> buf_a, buf_b;
+        size_t size_a = (size_t) ((mc + MR - 1) / MR) * MR * KC,
+               size_b = (size_t) ((nc + NR - 1) / NR) * NR * KC;
+        if (buf_a.size() < size_a)
+            buf_a.resize(size_a);
+        if (buf_b.size() < size_b)
+            buf_b.resize(size_b);
+
+        for (uint32_t p0 = 0; p0 < k.k; p0 += KC) {
+            uint32_t kc = std::min(KC, k.k - p0);
+            bool accumulate = p0 > 0;
+
+            pack_a(buf_a.data(), k.i_begin, mc, p0, kc);
+            pack_b(buf_b.data(), p0, kc, k.j_begin, nc);
+
+            /* Visit the tiles column by column so that the current sliver of
+               B stays in the L1 cache, while the packed block of A is
+               streamed from the L2 cache */
+            for (uint32_t js = 0; js < nc; js += NR) {
+                uint32_t nr = std::min(NR, nc - js);
+                const Value *pb = buf_b.data() + (size_t) js * kc;
+
+                for (uint32_t is = 0; is < mc; is += MR) {
+                    uint32_t mr = std::min(MR, mc - is);
+                    const Value *pa = buf_a.data() + (size_t) is * kc;
+                    Value *out = c + (size_t) (k.i_begin + is) * ldc +
+                                 k.j_begin + js;
+
+                    if (mr == MR && nr == NR) {
+                        micro(kc, pa, pb, out, ldc, accumulate);
+                    } else {
+                        // Partial tile at the boundary, use a temporary
+                        alignas(64) Value tmp[MR * NR];
+                        micro(kc, pa, pb, tmp, NR, false);
+                        for (uint32_t i = 0; i < mr; ++i) {
+                            for (uint32_t j = 0; j < nr; ++j) {
+                                Value &r = out[i * ldc + j];
+                                r = accumulate ? r + tmp[i * NR + j]
+                                               : tmp[i * NR + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+void matmul_kernel(const MatmulKernel &k) {
+    switch (k.type) {
+        case MatmulType::Float32: Matmul<float>(k).eval(); break;
+        case MatmulType::Float64: Matmul<double>(k).eval(); break;
+    }
+}
+
+} // namespace DRJIT_DISPATCH_NS
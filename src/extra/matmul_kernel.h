@@ -0,0 +1,56 @@
+/*
+    matmul_kernel.h -- Interface between the CPU matrix multiplication
+    driver (matmul.cpp) and its packetized kernel (matmul_kernel.cpp)
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/* Like resample_kernel.h, this interface only uses builtin types since the
+   kernel is compiled once per instruction set (see 'drjit_add_dispatch()'). */
+
+/// Element types supported by the CPU matrix multiplication kernel
+enum class MatmulType : uint32_t { Float32, Float64 };
+
+/**
+ * \brief Describes a block of work for the CPU matrix multiplication kernel
+ *
+ * The kernel computes the block ``i_begin <= i < i_end``, ``j_begin <= j <
+ * j_end`` of the matrix product
+ *
+ *     c[i * c_row_stride + j] = sum_p A(i, p) * B(p, j),
+ *
+ * where ``0 <= p < k``, ``A(i, p) = a[i * a_row_stride + p * a_col_stride]``,
+ * and ``B(p, j) = b[p * b_row_stride + j * b_col_stride]``. Transposed
+ * operands are simply specified by swapping their row and column strides.
+ */
+struct MatmulKernel {
+    /// Type of all matrices
+    MatmulType type;
+
+    /// Range of rows and columns of the output computed by this call
+    uint32_t i_begin, i_end, j_begin, j_end;
+
+    /// Length of the inner (reduced) dimension
+    uint32_t k;
+
+    /// Left operand and its strides
+    const void *a;
+    size_t a_row_stride, a_col_stride;
+
+    /// Right operand and its strides
+    const void *b;
+    size_t b_row_stride, b_col_stride;
+
+    /// Output matrix (row-major) and the distance between its rows
+    void *c;
+    size_t c_row_stride;
+};
@@ -11,13 +11,29 @@
 #include <drjit/resample.h>
 #include <drjit/while_loop.h>
 #include <drjit/math.h>
+#include <drjit/dispatch.h>
 #include <nanothread/nanothread.h>
+#include "resample_kernel.h"
 #include <cmath>
 #include <algorithm>
 #include <any>
 
+/// Packetized CPU kernel, compiled for several instruction sets
+DRJIT_DISPATCH_DECLARE(resample_kernel, void(const ResampleKernel &))
+
 NAMESPACE_BEGIN(drjit)
 
+template <typename Value> constexpr ResampleType resample_type() {
+    if constexpr (std::is_same_v<Value, uint8_t>)
+        return ResampleType::UInt8;
+    else if constexpr (std::is_same_v<Value, half>)
+        return ResampleType::Float16;
+    else if constexpr (std::is_same_v<Value, float>)
+        return ResampleType::Float32;
+    else
+        return ResampleType::Float64;
+}
+
 /// Internal storage of 'Resampler' (hidden via pImpl pattern)
 struct Resampler::Impl {
     uint32_t source_res;
@@ -25,6 +41,7 @@ struct Resampler::Impl {
     uint32_t taps;
     unique_ptr<uint32_t[]> offset;
     unique_ptr<double[]> weights;
+    unique_ptr<float[]> weights_f;
     mutable std::any offset_cache;
     mutable std::any weights_cache;
 
@@ -84,7 +101,48 @@ struct Resampler::Impl {
             double normalization = 1.0 / sum;
             for (uint32_t l = 0; l < taps; l++)
                 weights[i * taps + l] *= normalization;
+
+            /* Move the footprint of outputs near the end of the signal back
+               into the valid range. The taps shifted out of the window have
+               zero weight. This lets the CPU kernel evaluate all taps without
+               bounds checks (see kernel()). */
+            uint32_t taps_in = std::min(taps, source_res);
+            if (offset_i + taps_in > source_res) {
+                uint32_t shift = offset_i + taps_in - source_res;
+                double *w = weights.get() + i * taps;
+                memmove(w + shift, w, (taps - shift) * sizeof(double));
+                for (uint32_t l = 0; l < shift; l++)
+                    w[l] = 0.0;
+                offset[i] = offset_i - shift;
+            }
         }
+
+        weights_f = unique_ptr<float[]>(new float[taps * target_res]);
+        for (size_t i = 0; i < (size_t) taps * target_res; ++i)
+            weights_f[i] = (float) weights[i];
+    }
+
+    /// Describe the resampling of a full pass to the CPU kernel
+    ResampleKernel kernel(ResampleType in_type, ResampleType out_type,
+                          uint32_t stride) const {
+        ResampleKernel k;
+        k.in_type = in_type;
+        k.out_type = out_type;
+        k.stride = stride;
+        // Taps beyond the end of the signal have zero weight
+        k.taps = std::min(taps, source_res);
+        k.weight_pitch = taps;
+        k.offset_bias = 0;
+        k.j_begin = 0;
+        k.j_end = target_res;
+        k.offset = offset.get();
+        if (in_type == ResampleType::Float64)
+            k.weights = weights.get();
+        else
+            k.weights = weights_f.get();
+        k.in = nullptr;
+        k.out = nullptr;
+        return k;
     }
 
     /// Cast the resampling weights into a device array of the desired precision
@@ -202,49 +260,43 @@ Resampler::Resampler(uint32_t source_res, uint32_t target_res,
 
 Resampler::~Resampler() { }
 
+/// Number of outputs per work unit when parallelizing over the resampled axis
+static constexpr uint32_t ResampleBlockSize = 16;
+
+/// Number of output rows per work unit of \ref Resampler::resample_2d()
+static constexpr uint32_t Resample2DBlockSize = 32;
+
 /// Resample on the CPU and parallelize via the thread pool
 template <typename Value>
 void Resampler::resample(const Value *source, Value *target,
                          uint32_t source_size, uint32_t stride) const {
     struct Task {
-        uint32_t source_res;
-        uint32_t target_res;
-        uint32_t taps;
-        uint32_t stride;
-        uint32_t inner_dim;
-        const uint32_t *offset;
-        const double *weights;
-        const Value *in;
-        Value *out;
+        ResampleKernel kernel;
+        uint32_t n_passes;
+        uint32_t source_pass_size;
+        uint32_t target_pass_size;
         bool parallelize_outer;
     };
 
     auto callback = [](uint32_t outer, void *payload) {
-        using Accum =
-            std::conditional_t<sizeof(Value) < sizeof(float), float, Value>;
-
-        Task t = *(Task *) payload;
-        for (uint32_t inner = 0; inner < t.inner_dim; ++inner) {
-            uint32_t i = t.parallelize_outer ? outer : inner,
-                     j = t.parallelize_outer ? inner : outer;
-
-            const Value *in =
-                t.in + ((i * t.source_res + t.offset[j]) * t.stride);
-            Value *out = t.out + (i * t.target_res + j) * t.stride;
-
-            for (uint32_t k = 0; k < t.stride; ++k) {
-                Accum accum = 0;
-                for (uint32_t l = 0; l < t.taps; ++l) {
-                    double weight = t.weights[j * t.taps + l];
-                    if (weight != 0) {
-                        Value value = in[l * t.stride + k];
-                        accum =
-                            fmadd((Accum) weight, (Accum) value, accum);
-                    }
-                }
-                if constexpr (std::is_same_v<Value, uint8_t>)
-                    accum = clip(accum, (uint8_t) 0, (uint8_t) 255);
-                *out++ = (Value) accum;
+        const Task &t = *(const Task *) payload;
+        ResampleKernel k = t.kernel;
+        const Value *in = (const Value *) k.in;
+        Value *out = (Value *) k.out;
+
+        if (t.parallelize_outer) {
+            // Resample a full pass
+            k.in = in + (size_t) outer * t.source_pass_size;
+            k.out = out + (size_t) outer * t.target_pass_size;
+            resample_kernel(k);
+        } else {
+            // Resample a block of outputs of every pass
+            k.j_begin = outer * ResampleBlockSize;
+            k.j_end = std::min(k.j_begin + ResampleBlockSize, k.j_end);
+            for (uint32_t i = 0; i < t.n_passes; ++i) {
+                k.in = in + (size_t) i * t.source_pass_size;
+                k.out = out + (size_t) i * t.target_pass_size;
+                resample_kernel(k);
             }
         }
     };
@@ -255,21 +307,20 @@ void Resampler::resample(const Value *source, Value *target,
     bool small_workload = std::max(source_size, target_size) < 256 * 256;
     bool parallelize_outer = small_workload || n_passes >= pool_size();
 
-    uint32_t outer_dim = parallelize_outer ? n_passes : d->target_res,
-             inner_dim = parallelize_outer ? d->target_res : n_passes;
+    uint32_t outer_dim =
+        parallelize_outer
+            ? n_passes
+            : (d->target_res + ResampleBlockSize - 1) / ResampleBlockSize;
 
     Task task {
-        d->source_res,
-        d->target_res,
-        d->taps,
-        stride,
-        inner_dim,
-        d->offset.get(),
-        d->weights.get(),
-        source,
-        target,
+        d->kernel(resample_type<Value>(), resample_type<Value>(), stride),
+        n_passes,
+        d->source_res * stride,
+        d->target_res * stride,
         parallelize_outer
     };
+    task.kernel.in = source;
+    task.kernel.out = target;
 
     if (small_workload) {
         for (uint32_t i = 0; i < outer_dim; ++i)
@@ -279,6 +330,92 @@ void Resampler::resample(const Value *source, Value *target,
     }
 }
 
+/// Fused separable resampling of two adjacent axes on the CPU
+template <typename Value>
+void Resampler::resample_2d(const Resampler &res_y, const Resampler &res_x,
+                            const Value *source, Value *target,
+                            uint32_t source_size, uint32_t channels) {
+    using Accum = std::conditional_t<std::is_same_v<Value, double>, double, float>;
+
+    struct Task {
+        const Impl *dy;
+        ResampleKernel kernel_x;
+        ResampleKernel kernel_y;
+        uint32_t n_blocks;
+        uint32_t source_row_size;
+        uint32_t target_row_size;
+        const Value *source;
+        Value *target;
+    };
+
+    /* Each work unit produces a block of output rows. It first resamples the
+       range of input rows referenced by the block along the horizontal axis
+       into a small intermediate buffer, and then resamples this buffer along
+       the vertical axis. This avoids a full-size intermediate array and keeps
+       the working set in the cache. */
+    auto callback = [](uint32_t index, void *payload) {
+        const Task &t = *(const Task *) payload;
+        const Impl &dy = *t.dy;
+
+        uint32_t pass = index / t.n_blocks,
+                 y0 = (index % t.n_blocks) * Resample2DBlockSize,
+                 y1 = std::min(y0 + Resample2DBlockSize, dy.target_res),
+                 r0 = dy.offset[y0],
+                 r1 = dy.offset[y1 - 1] + t.kernel_y.taps;
+
+        const Value *source =
+            t.source + (size_t) pass * dy.source_res * t.source_row_size;
+        Value *target =
+            t.target + (size_t) pass * dy.target_res * t.target_row_size;
+
+        unique_ptr<Accum[]> buf(
+            new Accum[(size_t) (r1 - r0) * t.target_row_size]);
+
+        ResampleKernel kx = t.kernel_x;
+        for (uint32_t r = r0; r < r1; ++r) {
+            kx.in = source + (size_t) r * t.source_row_size;
+            kx.out = buf.get() + (size_t) (r - r0) * t.target_row_size;
+            resample_kernel(kx);
+        }
+
+        ResampleKernel ky = t.kernel_y;
+        ky.offset_bias = r0;
+        ky.j_begin = y0;
+        ky.j_end = y1;
+        ky.in = buf.get();
+        ky.out = target;
+        resample_kernel(ky);
+    };
+
+    const Impl &dx = *res_x.d, &dy = *res_y.d;
+    uint32_t source_row_size = dx.source_res * channels,
+             target_row_size = dx.target_res * channels,
+             n_passes = source_size / (dy.source_res * source_row_size),
+             target_size = n_passes * dy.target_res * target_row_size,
+             n_blocks = (dy.target_res + Resample2DBlockSize - 1) /
+                        Resample2DBlockSize;
+
+    Task task {
+        &dy,
+        dx.kernel(resample_type<Value>(), resample_type<Accum>(), channels),
+        dy.kernel(resample_type<Accum>(), resample_type<Value>(),
+                  target_row_size),
+        n_blocks,
+        source_row_size,
+        target_row_size,
+        source,
+        target
+    };
+
+    uint32_t size = n_passes * n_blocks;
+    if (std::max(source_size, target_size) < 256 * 256) {
+        for (uint32_t i = 0; i < size; ++i)
+            callback(i, &task);
+    } else {
+        task_submit_and_wait(nullptr, size, callback, &task);
+    }
+}
+
 template <typename Array>
 Array Resampler::resample_fwd(const Array &source, uint32_t stride) const {
     using Accum = std::conditional_t<sizeof(scalar_t<Array>) <= 4,
@@ -387,6 +524,10 @@ template DRJIT_EXTRA_EXPORT void Resampler::resample(const uint8_t *, uint8_t *,
 template DRJIT_EXTRA_EXPORT void Resampler::resample(const half *, half *, uint32_t, uint32_t) const;
 template DRJIT_EXTRA_EXPORT void Resampler::resample(const float *, float *, uint32_t, uint32_t) const;
 template DRJIT_EXTRA_EXPORT void Resampler::resample(const double *, double *, uint32_t, uint32_t) const;
+template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const uint8_t *, uint8_t *, uint32_t, uint32_t);
+template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const half *, half *, uint32_t, uint32_t);
+template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const float *, float *, uint32_t, uint32_t);
+template DRJIT_EXTRA_EXPORT void Resampler::resample_2d(const Resampler &, const Resampler &, const double *, double *, uint32_t, uint32_t);
 
 #if defined(DRJIT_ENABLE_CUDA)
 template CUDAArray<half> Resampler::resample_fwd(const CUDAArray<half> &, uint32_t) const;
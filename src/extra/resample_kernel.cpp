@@ -0,0 +1,193 @@
+/*
+    resample_kernel.cpp -- Packetized CPU kernel of the Resampler class
+
+    This file is compiled once per instruction set via 'drjit_add_dispatch()'
+    and should not be built on its own. See resample_kernel.h for a
+    description of the interface.
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <drjit/packet.h>
+#include <drjit-core/half.h>
+#include "resample_kernel.h"
+#include <vector>
+
+namespace dr = drjit;
+
+namespace DRJIT_DISPATCH_NS {
+
+/// Load a packet of 'Value' elements and convert it to the accumulation type
+template <typename AccumP, typename Value>
+DRJIT_INLINE AccumP load_cvt(const Value *ptr) {
+    if constexpr (std::is_same_v<Value, dr::scalar_t<AccumP>>) {
+        return dr::load<AccumP>(ptr);
+    } else if constexpr (std::is_same_v<Value, dr::half>) {
+        // Half precision packets aren't supported, let the compiler vectorize
+        alignas(64) dr::scalar_t<AccumP> tmp[AccumP::Size];
+        for (size_t i = 0; i < AccumP::Size; ++i)
+            tmp[i] = (dr::scalar_t<AccumP>) ptr[i];
+        return dr::load_aligned<AccumP>(tmp);
+    } else {
+        return AccumP(dr::load<dr::Packet<Value, AccumP::Size>>(ptr));
+    }
+}
+
+/// Convert an accumulated value/packet to 'Value' and store it
+template <typename Value, typename Accum>
+DRJIT_INLINE void store_cvt(Value *ptr, Accum value) {
+    if constexpr (std::is_same_v<Value, uint8_t>)
+        value = dr::clip(value, 0.f, 255.f);
+
+    if constexpr (dr::is_array_v<Accum>) {
+        if constexpr (std::is_same_v<Value, dr::scalar_t<Accum>>) {
+            dr::store(ptr, value);
+        } else if constexpr (std::is_same_v<Value, dr::half>) {
+            alignas(64) dr::scalar_t<Accum> tmp[Accum::Size];
+            dr::store_aligned(tmp, value);
+            for (size_t i = 0; i < Accum::Size; ++i)
+                ptr[i] = (Value) tmp[i];
+        } else {
+            dr::store(ptr, dr::Packet<Value, Accum::Size>(value));
+        }
+    } else {
+        *ptr = (Value) value;
+    }
+}
+
+template <typename In, typename Out> struct Resample {
+    using Accum = std::conditional_t<std::is_same_v<In, double>, double, float>;
+    using AccumP = dr::Packet<Accum>;
+    using UInt32P = dr::Packet<uint32_t, AccumP::Size>;
+    static constexpr uint32_t Size = (uint32_t) AccumP::Size;
+
+    const ResampleKernel &k;
+    const Accum *weights;
+    const In *in;
+    Out *out;
+
+    Resample(const ResampleKernel &k)
+        : k(k), weights((const Accum *) k.weights), in((const In *) k.in),
+          out((Out *) k.out) { }
+
+    /// Compute a single output sample ('j', 'c') without vectorization
+    DRJIT_INLINE void eval_scalar(uint32_t j, uint32_t c, const In *in_j) {
+        const Accum *w = weights + j * k.weight_pitch;
+        Accum accum = 0;
+        for (uint32_t l = 0; l < k.taps; ++l)
+            accum = dr::fmadd(w[l], (Accum) in_j[l * k.stride + c], accum);
+        store_cvt(out + j * k.stride + c, accum);
+    }
+
+    /**
+     * Vectorize over the channels of an output sample. This is the method of
+     * choice when the samples along the resampled axis are far apart, e.g.,
+     * when resampling the vertical axis of an image.
+     */
+    void eval_wide() {
+        for (uint32_t j = k.j_begin; j < k.j_end; ++j) {
+            const In *in_j = in + (k.offset[j] - k.offset_bias) * k.stride;
+            const Accum *w = weights + j * k.weight_pitch;
+            Out *out_j = out + j * k.stride;
+
+            uint32_t c = 0;
+            for (; c + Size <= k.stride; c += Size) {
+                AccumP accum = 0;
+                for (uint32_t l = 0; l < k.taps; ++l)
+                    accum = dr::fmadd(AccumP(w[l]),
+                                      load_cvt<AccumP>(in_j + l * k.stride + c),
+                                      accum);
+                store_cvt(out_j + c, accum);
+            }
+
+            for (; c < k.stride; ++c)
+                eval_scalar(j, c, in_j);
+        }
+    }
+
+    /**
+     * Vectorize over adjacent output samples, which requires gathers. This is
+     * used when there are only a few channels, e.g., when resampling the
+     * horizontal axis of an RGB image. Inputs that don't match the
+     * accumulation type are first converted into a scratch buffer.
+     */
+    void eval_narrow() {
+        uint32_t lo = k.offset[k.j_begin] - k.offset_bias,
+                 hi = k.offset[k.j_end - 1] - k.offset_bias + k.taps;
+
+        const Accum *src;
+        if constexpr (std::is_same_v<In, Accum>) {
+            src = in + lo * k.stride;
+        } else {
+            thread_local std::vector<Accum> scratch;
+            size_t size = (size_t) (hi - lo) * k.stride;
+            if (scratch.size() < size)
+                scratch.resize(size);
+            const In *in_lo = in + lo * k.stride;
+            for (size_t i = 0; i < size; ++i)
+                scratch[i] = (Accum) in_lo[i];
+            src = scratch.data();
+        }
+
+        uint32_t j = k.j_begin;
+        for (; j + Size <= k.j_end; j += Size) {
+            UInt32P j_p = dr::arange<UInt32P>() + j,
+                    in_idx = (dr::load<UInt32P>(k.offset + j) -
+                              (k.offset_bias + lo)) * k.stride,
+                    w_idx = j_p * k.weight_pitch;
+
+            for (uint32_t c = 0; c < k.stride; ++c) {
+                AccumP accum = 0;
+                for (uint32_t l = 0; l < k.taps; ++l) {
+                    AccumP w = dr::gather<AccumP>(weights, w_idx + l),
+                           v = dr::gather<AccumP>(src, in_idx + (l * k.stride + c));
+                    accum = dr::fmadd(w, v, accum);
+                }
+
+                alignas(64) Accum tmp[Size];
+                dr::store_aligned(tmp, accum);
+                for (uint32_t i = 0; i < Size; ++i)
+                    store_cvt(out + (j + i) * k.stride + c, tmp[i]);
+            }
+        }
+
+        for (; j < k.j_end; ++j) {
+            const In *in_j = in + (k.offset[j] - k.offset_bias) * k.stride;
+            for (uint32_t c = 0; c < k.stride; ++c)
+                eval_scalar(j, c, in_j);
+        }
+    }
+
+    void eval() {
+        if (k.j_begin >= k.j_end)
+            return;
+        else if (k.stride >= Size)
+            eval_wide();
+        else
+            eval_narrow();
+    }
+};
+
+template <typename In> void resample_kernel_2(const ResampleKernel &k) {
+    switch (k.out_type) {
+        case ResampleType::UInt8:   Resample<In, uint8_t>(k).eval(); break;
+        case ResampleType::Float16: Resample<In, dr::half>(k).eval(); break;
+        case ResampleType::Float32: Resample<In, float>(k).eval(); break;
+        default: break;
+    }
+}
+
+void resample_kernel(const ResampleKernel &k) {
+    switch (k.in_type) {
+        case ResampleType::UInt8:   resample_kernel_2<uint8_t>(k); break;
+        case ResampleType::Float16: resample_kernel_2<dr::half>(k); break;
+        case ResampleType::Float32: resample_kernel_2<float>(k); break;
+        case ResampleType::Float64: Resample<double, double>(k).eval(); break;
+    }
+}
+
+} // namespace DRJIT_DISPATCH_NS
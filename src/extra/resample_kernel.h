@@ -0,0 +1,65 @@
+/*
+    resample_kernel.h -- Interface between the Resampler class and its
+    packetized CPU kernel (resample_kernel.cpp)
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+/* The kernel is compiled once per instruction set (see 'drjit_add_dispatch()'
+   in resources/drjit-dispatch.cmake) and therefore cannot exchange Dr.Jit
+   types with the rest of the library. The data structures below only use
+   builtin types and are deliberately placed outside of the 'drjit' namespace. */
+
+/// Element types supported by the CPU resampling kernel
+enum class ResampleType : uint32_t { UInt8, Float16, Float32, Float64 };
+
+/**
+ * \brief Describes a batch of work for the CPU resampling kernel
+ *
+ * The kernel computes the outputs ``j_begin .. j_end-1`` along the resampled
+ * axis of a single pass, i.e.
+ *
+ *     out[j * stride + k] = sum_l weights[j * weight_pitch + l] *
+ *                           in[(offset[j] - offset_bias + l) * stride + k]
+ *
+ * for all channels ``0 <= k < stride`` and taps ``0 <= l < taps``. The
+ * offsets must be chosen so that these reads stay in bounds, which allows the
+ * kernel to evaluate all taps without branches.
+ */
+struct ResampleKernel {
+    /// Type of the input and output arrays
+    ResampleType in_type, out_type;
+
+    /// Distance between adjacent samples along the resampled axis
+    uint32_t stride;
+
+    /// Number of taps evaluated per output
+    uint32_t taps;
+
+    /// Distance between the weights of adjacent outputs
+    uint32_t weight_pitch;
+
+    /// Value subtracted from 'offset' (used when 'in' is a partial buffer)
+    uint32_t offset_bias;
+
+    /// Range of outputs along the resampled axis computed by this call
+    uint32_t j_begin, j_end;
+
+    /// Index of the first input sample of each output
+    const uint32_t *offset;
+
+    /// Weights (single precision, or double when 'in_type' is Float64)
+    const void *weights;
+
+    /// Input and output array of the current pass
+    const void *in;
+    void *out;
+};
@@ -17,6 +17,7 @@
 #include "shape.h"
 #include "init.h"
 #include <algorithm>
+#include <unordered_map>
 
 static const char *op_names[] = {
     // Unary operations
@@ -135,6 +136,48 @@ template <typename... Args> NB_INLINE Py_ssize_t maxv(Py_ssize_t arg, Args... ar
 }
 
 
+/**
+ * Fast path for the promotion step of binary operations that combine a
+ * flat, dynamically sized Dr.Jit array with a Python ``int`` or ``float``
+ * (e.g., ``x * 2``). Such expressions are very common when tracing code,
+ * and the general ``promote()`` function handles them through a relatively
+ * costly sequence of steps that ends with a call to the array constructor.
+ * Here, the scalar is directly converted into a literal of the array's type.
+ * Returns ``false`` when the shortcut does not apply, e.g. when the operation
+ * would promote the array to another type (``Int32`` and ``float``).
+ */
+static bool promote_scalar(nb::object *o) {
+    nb::handle tp0 = o[0].type(), tp1 = o[1].type();
+    size_t ai = is_drjit_type(tp0) ? 0 : 1;
+    nb::handle tp = ai == 0 ? tp0 : tp1,
+               stp = ai == 0 ? tp1 : tp0;
+
+    if (!is_drjit_type(tp))
+        return false;
+
+    const ArraySupplement &s = supp(tp);
+    if (s.ndim != 1 || s.is_tensor || s.is_class || !s.init_const)
+        return false;
+
+    VarType vt = (VarType) s.type;
+    bool compatible;
+    if (stp.is(&PyFloat_Type))
+        compatible = is_float(s);
+    else if (stp.is(&PyLong_Type))
+        compatible = is_float(s) || (vt >= VarType::Int8 && vt <= VarType::UInt64);
+    else
+        compatible = false;
+
+    if (!compatible)
+        return false;
+
+    nb::object result = nb::inst_alloc(tp);
+    s.init_const(1, false, o[1 - ai].ptr(), inst_ptr(result));
+    nb::inst_mark_ready(result);
+    o[1 - ai] = std::move(result);
+    return true;
+}
+
 namespace detail {
 
 struct Arg;
@@ -176,7 +219,12 @@ PyObject *apply(ArrayOp op, Slot slot, std::index_sequence<Is...> is,
     try {
         // All arguments must first be promoted to the same type
         if (!(o[Is].type().is(tp) && ...)) {
-            promote(o, sizeof...(Args), Mode == Select);
+            bool promoted = false;
+            if constexpr (N == 2 && (Mode == Normal || Mode == InPlace ||
+                                     Mode == RichCompare))
+                promoted = promote_scalar(o);
+            if (!promoted)
+                promote(o, sizeof...(Args), Mode == Select);
             tp = o[Mode == Select ? 1 : 0].type();
         }
 
@@ -624,8 +672,103 @@ struct recursion_guard {
 };
 } // namespace
 
+/// Cache of traversal plans indexed by type. The map is node-based so that
+/// references to plans remain valid while others are added or removed.
+static std::unordered_map<const void *, TraversePlan> *traverse_plans =
+    new std::unordered_map<const void *, TraversePlan>();
+
+#if !defined(Py_LIMITED_API)
+/// Return the version tag of a type, which changes when the type is modified
+static unsigned int type_version(PyTypeObject *tp) {
+#if PY_VERSION_HEX >= 0x030C0000
+    PyUnstable_Type_AssignVersionTag(tp);
+#endif
+    return PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG)
+               ? tp->tp_version_tag : 0;
+}
+#else
+/// The stable ABI does not expose version tags. Instead, check the identity of
+/// the attributes that mark custom data structures.
+static nb::object type_key(nb::handle tp) {
+    return nb::make_tuple(
+        nb::getattr(tp, DR_STR(DRJIT_STRUCT), nb::none()),
+        nb::getattr(tp, DR_STR(__dataclass_fields__), nb::none()));
+}
+
+static bool type_key_matches(nb::handle key, nb::handle tp) {
+    nb::handle ds = PyTuple_GetItem(key.ptr(), 0),
+               df = PyTuple_GetItem(key.ptr(), 1);
+    return nb::getattr(tp, DR_STR(DRJIT_STRUCT), nb::none()).is(ds) &&
+           nb::getattr(tp, DR_STR(__dataclass_fields__), nb::none()).is(df);
+}
+#endif
+
+const TraversePlan &traverse_plan(nb::handle tp) {
+    const void *key = tp.ptr();
+
+    if (auto it = traverse_plans->find(key); it != traverse_plans->end()) {
+#if !defined(Py_LIMITED_API)
+        unsigned int version = type_version((PyTypeObject *) tp.ptr());
+        if (version != 0 && version == it->second.version)
+            return it->second;
+#else
+        if (type_key_matches(it->second.key, tp))
+            return it->second;
+#endif
+    }
+
+    TraversePlan plan;
+    if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
+        plan.kind = TraversePlan::Kind::Struct;
+        plan.fields = std::move(ds);
+    } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
+        nb::list names;
+        for (nb::handle field : df) {
+            PyObject *name = field.attr(DR_STR(name)).release().ptr();
+            PyUnicode_InternInPlace(&name);
+            names.append(nb::steal(name));
+        }
+        plan.kind = TraversePlan::Kind::Dataclass;
+        plan.fields = nb::steal(PyList_AsTuple(names.ptr()));
+        if (!plan.fields.is_valid())
+            nb::raise_python_error();
+    } else {
+        plan.nb_type = nb::type_check(tp);
+        plan.cb_ro = get_traverse_cb_ro(tp);
+        plan.cb_rw = get_traverse_cb_rw(tp);
+    }
+
+#if !defined(Py_LIMITED_API)
+    plan.version = type_version((PyTypeObject *) tp.ptr());
+#else
+    plan.key = type_key(tp);
+#endif
+
+    // The code above may have run the garbage collector, look up the entry again
+    auto [it, inserted] = traverse_plans->try_emplace(key);
+    TraversePlan &result = it->second;
+    if (inserted) {
+        try {
+            plan.weakref = nb::weakref(tp, nb::cpp_function([key](nb::handle) {
+                traverse_plans->erase(key);
+            }));
+        } catch (...) {
+            traverse_plans->erase(it);
+            throw;
+        }
+    } else {
+        plan.weakref = std::move(result.weakref);
+    }
+
+    result = std::move(plan);
+    return result;
+}
+
+void traverse_plan_clear() { traverse_plans->clear(); }
+
 uint64_t TraverseCallback::operator()(uint64_t, const char *, const char *) { return 0; }
 void TraverseCallback::traverse_unknown(nb::handle) { }
+bool TraverseCallback::modifies() const { return false; }
 
 /// Invoke the given callback on leaf elements of the pytree 'h'
 void traverse(const char *op, TraverseCallback &tc, nb::handle h, bool rw) {
@@ -637,6 +780,8 @@ void traverse(const char *op, TraverseCallback &tc, nb::handle h, bool rw) {
         if (is_drjit_type(tp)) {
             const ArraySupplement &s = supp(tp);
             if (s.is_tensor) {
+                if (rw || tc.modifies())
+                    s.tensor_materialize(inst_ptr(h));
                 tc(nb::steal(s.tensor_array(h.ptr())));
             } else if (s.ndim > 1) {
                 Py_ssize_t len = s.shape[0];
@@ -657,49 +802,55 @@ void traverse(const char *op, TraverseCallback &tc, nb::handle h, bool rw) {
         } else if (tp.is(&PyDict_Type)) {
             for (nb::handle h2 : nb::borrow<nb::dict>(h).values())
                 traverse(op, tc, h2, rw);
-        } else if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
-            for (auto [k, v] : ds)
-                traverse(op, tc, nb::getattr(h, k), rw);
-        } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
-            for (nb::handle field : df) {
-                nb::object k = field.attr(DR_STR(name));
-                traverse(op, tc, nb::getattr(h, k), rw);
-            }
-        } else if (auto traversable = get_traversable_base(h); traversable) {
-            struct Payload {
-                TraverseCallback &tc;
-            };
-            Payload p{ tc };
-            if (rw) {
-                traversable->traverse_1_cb_rw(
-                    (void *) &p,
-                    [](void *p, uint64_t index, const char *variant,
-                       const char *domain) -> uint64_t {
-                        Payload *payload = (Payload *) p;
-                        uint64_t new_index =
+        } else {
+            const TraversePlan &plan = traverse_plan(tp);
+            nb::object fields = plan.fields;
+            drjit::TraversableBase *traversable = nullptr;
+
+            if (plan.kind == TraversePlan::Kind::Struct) {
+                for (auto [k, v] : nb::borrow<nb::dict>(fields))
+                    traverse(op, tc, nb::getattr(h, k), rw);
+            } else if (plan.kind == TraversePlan::Kind::Dataclass) {
+                for (nb::handle k : nb::borrow<nb::tuple>(fields))
+                    traverse(op, tc, nb::getattr(h, k), rw);
+            } else if (plan.nb_type &&
+                       (traversable = get_traversable_base(h)) != nullptr) {
+                struct Payload {
+                    TraverseCallback &tc;
+                };
+                Payload p{ tc };
+                if (rw) {
+                    traversable->traverse_1_cb_rw(
+                        (void *) &p,
+                        [](void *p, uint64_t index, const char *variant,
+                           const char *domain) -> uint64_t {
+                            Payload *payload = (Payload *) p;
+                            uint64_t new_index =
+                                payload->tc(index, variant, domain);
+                            return new_index;
+                        });
+                } else {
+                    traversable->traverse_1_cb_ro(
+                        (void *) &p, [](void *p, uint64_t index,
+                                        const char *variant, const char *domain) {
+                            Payload *payload = (Payload *) p;
                             payload->tc(index, variant, domain);
-                        return new_index;
-                    });
+                        });
+                }
+            } else if (plan.cb_ro.is_valid() && !rw) {
+                nb::object cb = plan.cb_ro;
+                cb(h, nb::cpp_function(
+                          [&](uint64_t index, const char *variant,
+                              const char *domain) { tc(index, variant, domain); }));
+            } else if (plan.cb_rw.is_valid() && rw) {
+                nb::object cb_rw = plan.cb_rw;
+                cb_rw(h, nb::cpp_function([&](uint64_t index, const char *variant,
+                                           const char *domain) {
+                       return tc(index, variant, domain);
+                   }));
             } else {
-                traversable->traverse_1_cb_ro(
-                    (void *) &p, [](void *p, uint64_t index,
-                                    const char *variant, const char *domain) {
-                        Payload *payload = (Payload *) p;
-                        payload->tc(index, variant, domain);
-                    });
+                tc.traverse_unknown(h);
             }
-        } else if (auto cb = get_traverse_cb_ro(tp); cb.is_valid() && !rw) {
-            cb(h, nb::cpp_function(
-                      [&](uint64_t index, const char *variant,
-                          const char *domain) { tc(index, variant, domain); }));
-        } else if (nb::object cb_rw = get_traverse_cb_rw(tp);
-                   cb_rw.is_valid() && rw) {
-            cb_rw(h, nb::cpp_function([&](uint64_t index, const char *variant,
-                                       const char *domain) {
-                   return tc(index, variant, domain);
-               }));
-        } else {
-            tc.traverse_unknown(h);
         }
     } catch (nb::python_error &e) {
         nb::raise_from(e, PyExc_RuntimeError,
@@ -822,17 +973,19 @@ void traverse_pair_impl(const char *op, TraversePairCallback &tc, nb::handle h1,
             name.resize(name_size);
         }
     } else {
-        if (nb::dict ds = get_drjit_struct(tp1); ds.is_valid()) {
-            for (auto [k, v] : ds) {
+        const TraversePlan &plan = traverse_plan(tp1);
+        nb::object fields = plan.fields;
+
+        if (plan.kind == TraversePlan::Kind::Struct) {
+            for (auto [k, v] : nb::borrow<nb::dict>(fields)) {
                 name.put('.', nb::str(k).c_str());
                 traverse_pair_impl(op, tc, nb::getattr(h1, k),
                                    nb::getattr(h2, k), name, stack,
                                    report_inconsistencies, width_consistency);
                 name.resize(name_size);
             }
-        } else if (nb::object df = get_dataclass_fields(tp1); df.is_valid()) {
-            for (nb::handle field : df) {
-                nb::object k = field.attr(DR_STR(name));
+        } else if (plan.kind == TraversePlan::Kind::Dataclass) {
+            for (nb::handle k : nb::borrow<nb::tuple>(fields)) {
                 name.put('.', nb::str(k).c_str());
                 traverse_pair_impl(op, tc, nb::getattr(h1, k),
                                    nb::getattr(h2, k), name, stack,
@@ -940,24 +1093,27 @@ nb::object transform(const char *op, TransformCallback &tc, nb::handle h) {
             for (auto [k, v] : nb::borrow<nb::dict>(h))
                 tmp[k] = transform(op, tc, v);
             result = std::move(tmp);
-        } else if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
-            nb::object tmp = tp();
-            for (auto [k, v] : ds)
-                nb::setattr(tmp, k, transform(op, tc, nb::getattr(h, k)));
-            result = std::move(tmp);
-        } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
-            nb::object tmp = nb::dict();
-            for (nb::handle field : df) {
-                nb::object k = field.attr(DR_STR(name));
-                tmp[k]       = transform(op, tc, nb::getattr(h, k));
+        } else {
+            const TraversePlan &plan = traverse_plan(tp);
+            nb::object fields = plan.fields, cb = plan.cb_rw;
+
+            if (plan.kind == TraversePlan::Kind::Struct) {
+                nb::object tmp = tp();
+                for (auto [k, v] : nb::borrow<nb::dict>(fields))
+                    nb::setattr(tmp, k, transform(op, tc, nb::getattr(h, k)));
+                result = std::move(tmp);
+            } else if (plan.kind == TraversePlan::Kind::Dataclass) {
+                nb::object tmp = nb::dict();
+                for (nb::handle k : nb::borrow<nb::tuple>(fields))
+                    tmp[k] = transform(op, tc, nb::getattr(h, k));
+                result = tp(**tmp);
+            } else if (cb.is_valid()) {
+                cb(h, nb::cpp_function([&](uint64_t index, const char *,
+                                           const char *) { return tc(index); }));
+                result = nb::borrow(h);
+            } else {
+                result = tc.transform_unknown(h);
             }
-            result = tp(**tmp);
-        } else if (nb::object cb = get_traverse_cb_rw(tp); cb.is_valid()) {
-            cb(h, nb::cpp_function([&](uint64_t index, const char *,
-                                       const char *) { return tc(index); }));
-            result = nb::borrow(h);
-        } else if (!result.is_valid()) {
-            result = tc.transform_unknown(h);
         }
         return result;
     } catch (nb::python_error &e) {
@@ -1085,17 +1241,19 @@ nb::object transform_pair(const char *op, TransformPairCallback &tc,
 
             return std::move(result);
         } else {
-            if (nb::dict ds = get_drjit_struct(tp1); ds.is_valid()) {
+            const TraversePlan &plan = traverse_plan(tp1);
+            nb::object fields = plan.fields;
+
+            if (plan.kind == TraversePlan::Kind::Struct) {
                 nb::object result = tp1();
-                for (auto [k, v] : ds)
+                for (auto [k, v] : nb::borrow<nb::dict>(fields))
                     nb::setattr(result, k,
                                 transform_pair(op, tc, nb::getattr(h1, k),
                                                nb::getattr(h2, k)));
                 return result;
-            } else if (nb::object df = get_dataclass_fields(tp1); df.is_valid()) {
+            } else if (plan.kind == TraversePlan::Kind::Dataclass) {
                 nb::dict result;
-                for (nb::handle field : df) {
-                    nb::object k = field.attr(DR_STR(name));
+                for (nb::handle k : nb::borrow<nb::tuple>(fields)) {
                     result[k] = transform_pair(op, tc, nb::getattr(h1, k),
                                                nb::getattr(h2, k));
                 }
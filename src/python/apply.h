@@ -68,6 +68,10 @@ struct TraverseCallback {
 
     // Traverse an unknown object
     virtual void traverse_unknown(nb::handle h);
+
+    // Does the callback modify the arrays it receives? Tensors that are
+    // strided views are then converted into contiguous tensors beforehand.
+    virtual bool modifies() const;
 };
 
 /// Callback for the ``traverse_pair()`` operation below
@@ -119,6 +123,56 @@ struct TransformPairCallback {
     virtual nb::object transform_unknown(nb::handle h1, nb::handle h2) const;
 };
 
+/**
+ * \brief Per-type information that the PyTree traversal functions below use
+ * to process instances of types other than Dr.Jit arrays, tuples, lists, and
+ * dictionaries.
+ *
+ * Discovering how to traverse a custom type involves several attribute
+ * lookups and, in the case of dataclasses, calls to ``dataclasses.fields()``
+ * and ``typing.get_type_hints()``. The result of this process is therefore
+ * cached per type and recomputed when the type is modified.
+ */
+struct TraversePlan {
+    enum class Kind : uint8_t {
+        /// Custom data structure with a ``DRJIT_STRUCT`` annotation
+        Struct,
+
+        /// Data class, traversed via its fields
+        Dataclass,
+
+        /// Any other type (e.g., a C++ object or a Python scalar)
+        Opaque
+    };
+
+    Kind kind = Kind::Opaque;
+
+    /// Could instances derive from ``drjit::TraversableBase``?
+    bool nb_type = false;
+
+    /// ``DRJIT_STRUCT`` dictionary or tuple of (interned) dataclass field names
+    nb::object fields;
+
+    /// ``_traverse_1_cb_ro`` / ``_traverse_1_cb_rw`` callbacks, if present
+    nb::object cb_ro, cb_rw;
+
+    /// Used to detect modifications of the type
+#if !defined(Py_LIMITED_API)
+    unsigned int version = 0;
+#else
+    nb::object key;
+#endif
+
+    /// Removes the plan from the cache when the type is garbage collected
+    nb::object weakref;
+};
+
+/// Look up (or create) the traversal plan of the type 'tp'
+extern const TraversePlan &traverse_plan(nb::handle tp);
+
+/// Release all cached traversal plans (called at shutdown)
+extern void traverse_plan_clear();
+
 /**
  * \brief Invoke the given callback on leaf elements of the pytree 'h',
  *     including JIT indices in c++ objects, inheriting from
@@ -135,7 +189,8 @@ struct TransformPairCallback {
  *     Boolean, indicating if C++ objects should be traversed in read-write
  *     mode. If this is set to \c true, the result from the method
  *     \c operator()(uint64_t) of the callback will be assigned to the
- *     underlying variable. This does not change how Python objects are
+ *     underlying variable. Apart from converting strided tensor views into
+ *     contiguous tensors, this does not change how Python objects are
  *     traversed.
  */
 extern void traverse(const char *op, TraverseCallback &callback, nb::handle h,
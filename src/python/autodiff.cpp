@@ -23,6 +23,8 @@ static void set_grad_enabled(nb::handle h, bool enable_) {
         bool enable;
         SetGradEnabled(bool enable) : enable(enable) { }
 
+        bool modifies() const override { return true; }
+
         void operator()(nb::handle h) override {
             nb::handle tp = h.type();
             const ArraySupplement &s = supp(tp);
@@ -15,6 +15,7 @@
 #include "meta.h"
 #include "init.h"
 #include "traits.h"
+#include "slice.h"
 
 /**
  * \brief Create a deep copy of a PyTree
@@ -451,6 +452,11 @@ void export_detail(nb::module_ &) {
 
      .def("any_symbolic", &any_symbolic, doc_detail_any_symbolic)
 
+     .def("tensor_layout", &tensor_layout, "arg"_a, doc_detail_tensor_layout)
+
+     .def("tensor_view", &tensor_view, "arg"_a, "shape"_a, "strides"_a,
+          "offset"_a, doc_detail_tensor_view)
+
      .def("reduce_identity", &reduce_identity,
           nb::sig("def reduce_identity(dtype: typing.Type[drjit.ArrayT], op: drjit.ReduceOp, size: int = 1, /) -> drjit.ArrayT"),
           doc_detail_reduce_identity, "dtype"_a, "op"_a, "size"_a = 1)
@@ -469,6 +475,11 @@ void export_detail(nb::module_ &) {
 
     d.def("leak_warnings", &leak_warnings, doc_leak_warnings);
     d.def("set_leak_warnings", &set_leak_warnings, doc_set_leak_warnings);
+    d.def("coop_vec_expand", []() { return (bool) ad_coop_vec_expand(); },
+          doc_coop_vec_expand);
+    d.def("set_coop_vec_expand",
+          [](bool value) { ad_set_coop_vec_expand(value); }, "value"_a,
+          doc_set_coop_vec_expand);
     d.def("traverse_py_cb_ro", &traverse_py_cb_ro_impl);
     d.def("traverse_py_cb_rw", &traverse_py_cb_rw_impl);
     d.def("freeze_discard", jit_freeze_discard);
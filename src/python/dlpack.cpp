@@ -162,9 +162,10 @@ static nb::ndarray<> dlpack(nb::handle_t<ArrayBase> h, bool force_cpu, nb::handl
                     nb::inst_replace_move(owner, tmp);
             }
         } else {
+            // Reuse the flattened tensor, which keeps copies of views alive
             nb::object arr = nb::borrow(h);
             if (s.is_tensor)
-                arr = nb::steal(s.tensor_array(h.ptr()));
+                arr = owner;
             ptr = s2.data(inst_ptr(arr));
         }
     } else {
@@ -250,6 +251,55 @@ static nb::tuple dlpack_device(nb::handle_t<ArrayBase> h) {
     return nb::make_tuple(device_type, device_id);
 }
 
+/// Recreate an array from its shape and a buffer holding the raw data. This
+/// function is the counterpart of the ``__reduce_ex__()`` method below.
+static nb::object unpickle_array(nb::type_object tp, nb::tuple shape,
+                                 nb::handle buffer) {
+    const ArraySupplement &s = supp(tp);
+
+    // The memoryview holds on to the buffer while it is in use
+    nb::object owner = nb::steal(PyMemoryView_FromObject(buffer.ptr()));
+    if (!owner.is_valid())
+        nb::raise_python_error();
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(owner.ptr(), &view, PyBUF_SIMPLE))
+        nb::raise_python_error();
+    void *ptr = view.buf;
+    size_t nbytes = (size_t) view.len;
+    bool readonly = view.readonly;
+    PyBuffer_Release(&view);
+
+    nb::dlpack::dtype dtype = drjit_type_to_dlpack((VarType) s.type);
+    size_t ndim = shape.size(), size = dtype.bits / 8;
+    vector<size_t> shape_v(ndim);
+    for (size_t i = 0; i < ndim; ++i) {
+        shape_v[i] = nb::cast<size_t>(shape[i]);
+        size *= shape_v[i];
+    }
+
+    if (size != nbytes)
+        nb::raise("drjit.detail.unpickle_array(): expected a buffer with %zu "
+                  "bytes, got %zu bytes.", size, nbytes);
+
+    // Dr.Jit may write to memory that it maps without copying, hence only
+    // writable buffers are used in place. This includes the 'bytearray' that
+    // in-band pickling produces for the (writable) 'PickleBuffer' created by
+    // __reduce_ex__, and writable out-of-band buffers. Read-only buffers
+    // (e.g., 'bytes' or an out-of-band buffer from read-only memory) are
+    // copied.
+    if (readonly) {
+        nb::bytearray copy(ptr, nbytes);
+        ptr = copy.data();
+        owner = std::move(copy);
+    }
+
+    nb::ndarray ndarray =
+        nb::ndarray<nb::memview>(ptr, ndim, shape_v.data(), owner, nullptr,
+                                 dtype, nb::device::cpu::value);
+    return tp(ndarray);
+}
+
 void export_dlpack(nb::module_ &) {
     nb::class_<ArrayBase> ab = nb::borrow<nb::class_<ArrayBase>>(array_base);
 
@@ -301,6 +351,31 @@ void export_dlpack(nb::module_ &) {
                 return nb::ndarray<nb::memview>(dlpack(h, true).handle());
            }, doc_memview)
 
+      .def("__reduce_ex__",
+           [](nb::handle_t<ArrayBase> h, int protocol) -> nb::object {
+               // Use __getstate__/__setstate__ with older protocols
+               if (protocol < 5)
+                   return nb::handle((PyObject *) &PyBaseObject_Type)
+                       .attr("__reduce_ex__")(h, protocol);
+
+               // Protocol 5 supports out-of-band buffers, which pickle can
+               // hand to the application instead of copying them into the
+               // stream. The buffer references the array's memory directly.
+               nb::ndarray<> ndarray = dlpack(h, true);
+               size_t nbytes = ndarray.nbytes();
+               nb::object data = nb::cast(nb::ndarray<nb::memview>(ndarray.handle())),
+                          bytes = nb::cast(nb::ndarray<nb::memview, uint8_t>(
+                              ndarray.data(), 1, &nbytes, data));
+
+               nb::module_ pickle = nb::module_::import_("pickle"),
+                           detail = nb::module_::import_("drjit.detail");
+
+               return nb::make_tuple(
+                   detail.attr("unpickle_array"),
+                   nb::make_tuple(h.type(), h.attr("shape"),
+                                  pickle.attr("PickleBuffer")(bytes)));
+           }, "protocol"_a)
+
       .def("__getstate__",
            [](nb::handle_t<ArrayBase> h) {
                nb::ndarray<> ndarray = dlpack(h, true);
@@ -330,4 +405,8 @@ void export_dlpack(nb::module_ &) {
                nb::object result = self.type()(ndarray);
                nb::inst_move(self, result);
            });
+
+    nb::module_ detail = nb::module_::import_("drjit.detail");
+    detail.def("unpickle_array", &unpickle_array, "tp"_a, "shape"_a,
+               "buffer"_a, doc_detail_unpickle_array);
 }
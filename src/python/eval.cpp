@@ -20,6 +20,9 @@ bool schedule(nb::handle h) {
         bool &result;
         ScheduleCallback(bool &result) : result(result) { }
 
+        // Evaluate strided tensor views in place
+        bool modifies() const override { return true; }
+
         void operator()(nb::handle h) override {
             const ArraySupplement &s = supp(h.type());
             if (s.index)
@@ -48,6 +51,8 @@ static void make_opaque(nb::handle h) {
     struct ScheduleForceCallback : TraverseCallback {
         bool result = false;
 
+        bool modifies() const override { return true; }
+
         void operator()(nb::handle h) override {
             nb::handle tp = h.type();
             const ArraySupplement &s = supp(tp);
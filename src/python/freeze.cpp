@@ -140,6 +140,8 @@
 
 #include "../ext/nanobind/src/buffer.h"
 
+#include <chrono>
+
 #if defined(_MSC_VER)
 // Methods in this file will frequently use local variables, whose name matches class attributes.
 // This is intentional. The latter are prefixed with this->name. Tell MSVC not to warn about this.
@@ -150,14 +152,25 @@ using Buffer = nanobind::detail::Buffer;
 
 /**
  * \brief Helper struct to profile and log frozen functions.
+ *
+ * If a \c PhaseStats instance is provided, the time spent in the scope is
+ * additionally accumulated into it.
  */
 struct ProfilerPhase {
+    using clock = std::chrono::steady_clock;
+
     std::string m_message;
-    ProfilerPhase(const char *message) : m_message(message) {
+    detail::PhaseStats *m_stats = nullptr;
+    clock::time_point m_start;
+
+    ProfilerPhase(const char *message, detail::PhaseStats *stats = nullptr)
+        : m_message(message), m_stats(stats) {
         jit_log(LogLevel::Debug, "profiler start: %s", message);
 #if defined(DRJIT_ENABLE_NVTX)
         jit_profile_range_push(message);
 #endif
+        if (m_stats)
+            m_start = clock::now();
     }
 
     ProfilerPhase(const drjit::TraversableBase *traversable) {
@@ -171,6 +184,10 @@ struct ProfilerPhase {
     }
 
     ~ProfilerPhase() {
+        if (m_stats)
+            m_stats->add(
+                std::chrono::duration<double, std::milli>(clock::now() - m_start)
+                    .count());
 #if defined(DRJIT_ENABLE_NVTX)
         jit_profile_range_pop();
 #endif
@@ -229,7 +246,11 @@ bool Layout::operator==(const Layout &rhs) const {
             return false;
     }
 
-    if (this->index != rhs.index)
+    if (this->size_index != rhs.size_index)
+        return false;
+
+    // The size of literals with a symbolic size is not part of the key
+    if (!this->size_index && this->index != rhs.index)
         return false;
 
     if (this->flags != rhs.flags)
@@ -364,11 +385,17 @@ bool FlatVariables::fill_opaque_mask(FlatVariables &prev,
         Layout &layout_     = this->layout[i];
         Layout &prev_layout = prev.layout[i];
 
+        // Size changes of literals, that are bound to the same symbolic
+        // dimension, do not require them to be made opaque.
+        bool size_changed =
+            layout_.size_index != prev_layout.size_index ||
+            (!layout_.size_index &&
+             layout_.literal_size != prev_layout.literal_size);
+
         bool requires_opaque =
             (layout_.flags & (uint32_t) LayoutFlag::Literal) &&
             (prev_layout.flags & (uint32_t) LayoutFlag::Literal) &&
-            (layout_.literal != prev_layout.literal ||
-             layout_.literal_size != prev_layout.literal_size);
+            (layout_.literal != prev_layout.literal || size_changed);
 
         opaque_mask[i] |= requires_opaque;
         new_opaques |= requires_opaque;
@@ -486,6 +513,89 @@ void FlatVariables::record_jit_variables() {
     }
 }
 
+void FlatVariables::bind_symbolic_sizes(const FlatVariables &dims,
+                                        const drjit::vector<bool> *fixed_mask) {
+    uint32_t n_bound = 0;
+    for (uint32_t i = 0; i < this->layout.size(); i++) {
+        Layout &layout_ = this->layout[i];
+        layout_.size_index = 0;
+
+        if (!(layout_.flags & (uint32_t) LayoutFlag::Literal) ||
+            layout_.literal_size <= 1 ||
+            (fixed_mask && i < fixed_mask->size() && (*fixed_mask)[i]))
+            continue;
+
+        auto it = dims.size_to_slot.find(layout_.literal_size);
+        if (it == dims.size_to_slot.end())
+            continue;
+
+        layout_.size_index = it.value() + 1;
+        n_bound++;
+    }
+
+    if (n_bound)
+        jit_log(LogLevel::Debug,
+                "bind_symbolic_sizes(): %u literal variables bound to symbolic "
+                "dimensions",
+                n_bound);
+}
+
+bool FlatVariables::link_symbolic_literals(const FlatVariables &in,
+                                           drjit::vector<bool> &fixed_mask) {
+    // Bound input literals, by variable index and by size
+    tsl::robin_map<uint32_t, uint32_t, UInt32Hasher> bound_index, bound_size;
+    for (uint32_t i = 0; i < in.layout.size(); i++) {
+        const Layout &l = in.layout[i];
+        if (!l.size_index)
+            continue;
+        bound_index.try_emplace(l.literal_index, i);
+        bound_size[l.literal_size]++;
+    }
+
+    if (bound_index.empty())
+        return false;
+
+    uint32_t n_forwarded = 0, n_fixed = 0;
+    for (Layout &layout_ : this->layout) {
+        if (!(layout_.flags & ((uint32_t) LayoutFlag::Literal |
+                               (uint32_t) LayoutFlag::Undefined)))
+            continue;
+
+        auto it = bound_index.find(layout_.literal_index);
+        if (it != bound_index.end()) {
+            layout_.forward_index = it.value() + 1;
+            n_forwarded++;
+            continue;
+        }
+
+        // The recording doesn't reveal how this literal was computed. If its
+        // size matches a bound input literal, it may have been derived from
+        // it (e.g., via constant folding). The size of such inputs must
+        // remain part of the key.
+        if (layout_.literal_size <= 1 ||
+            bound_size.find(layout_.literal_size) == bound_size.end())
+            continue;
+
+        for (uint32_t i = 0; i < in.layout.size(); i++) {
+            const Layout &l = in.layout[i];
+            if (l.size_index && l.literal_size == layout_.literal_size &&
+                !fixed_mask[i]) {
+                fixed_mask[i] = true;
+                n_fixed++;
+            }
+        }
+        bound_size.erase(layout_.literal_size);
+    }
+
+    if (n_forwarded || n_fixed)
+        jit_log(LogLevel::Debug,
+                "link_symbolic_literals(): %u literal outputs forward an "
+                "input, the size of %u literal inputs is no longer symbolic",
+                n_forwarded, n_fixed);
+
+    return n_fixed > 0;
+}
+
 /**
  * This function returns an index of an equivalence class for the variable
  * size in the flattened variables.
@@ -550,6 +660,11 @@ uint32_t FlatVariables::construct_jit_index(uint32_t prev_index) {
     if ((layout_.flags & (uint32_t) LayoutFlag::Literal) ||
         (layout_.flags & (uint32_t) LayoutFlag::Undefined)) {
         index = layout_.literal_index;
+        // Use the current value of a forwarded input literal, whose size
+        // may differ from the one observed while recording
+        if (layout_.forward_index && forward_inputs)
+            index = forward_inputs->layout[layout_.forward_index - 1]
+                        .literal_index;
         jit_var_inc_ref(index);
         vt = (VarType) layout_.vt;
     } else {
@@ -1183,6 +1298,7 @@ void FlatVariables::assign(nb::handle dst, TraverseContext &ctx) {
             const ArraySupplement &s = supp(tp);
 
             if (s.is_tensor) {
+                s.tensor_materialize(inst_ptr(dst));
                 nb::handle array = s.tensor_array(dst.ptr());
                 assign(nb::steal(array), ctx);
             } else if (s.ndim != 1) {
@@ -1484,7 +1600,17 @@ bool log_diff(LogLevel level, const FlatVariables &curr,
         return false;
     }
 
-    if (curr_l.index != prev_l.index) {
+    if (curr_l.flags & ((uint32_t) LayoutFlag::Literal |
+                        (uint32_t) LayoutFlag::Undefined)) {
+        if (curr_l.size_index != prev_l.size_index ||
+            (!curr_l.size_index && curr_l.literal_size != prev_l.literal_size)) {
+            jit_log(level,
+                    "%s: The size of this literal changed from %u to %u, and "
+                    "it could not be bound to the same symbolic dimension.",
+                    ctx.path.get(), prev_l.literal_size, curr_l.literal_size);
+            return false;
+        }
+    } else if (curr_l.index != prev_l.index) {
         jit_log(level,
                 "%s: The index into the array of deduplicated variables "
                 "changed from s%u to s%u. This can occur if two variables "
@@ -1650,7 +1776,7 @@ size_t FlatVariablesHasher::operator()(
         } lkey;
         static_assert(sizeof(lkey) == sizeof(uint64_t));
         lkey.num   = layout_.num;
-        lkey.index = layout_.index;
+        lkey.index = layout_.size_index ? layout_.size_index : layout_.index;
         lkey.flags = layout_.flags;
         lkey.vt    = layout_.vt;
 
@@ -1703,10 +1829,11 @@ nb::object FunctionRecording::record(nb::callable func,
                                      FrozenFunction *frozen_func,
                                      nb::dict input,
                                      const FlatVariables &in_variables) {
-    ProfilerPhase profiler("record");
+    ProfilerPhase profiler("record", &frozen_func->stats.record);
     JitBackend backend = in_variables.backend;
 
     frozen_func->recording_counter++;
+    frozen_func->stats.n_records++;
     if (frozen_func->recording_counter > frozen_func->warn_recording_count &&
         frozen_func->recordings.size() >= 1) {
         if (frozen_func->recordings.size() < frozen_func->recording_counter) {
@@ -1743,7 +1870,7 @@ nb::object FunctionRecording::record(nb::callable func,
     // Record the function
     nb::object output;
     {
-        ProfilerPhase profiler2("function");
+        ProfilerPhase profiler2("function", &frozen_func->stats.function);
         state_unlock_guard guard;
         output = func(input);
     }
@@ -1793,6 +1920,13 @@ nb::object FunctionRecording::record(nb::callable func,
         }
 
         out_variables.record_jit_variables();
+
+        // Literal outputs retain the size observed while recording, unless
+        // they forward an input literal. Inputs that other literal outputs may
+        // have been computed from are excluded from symbolic binding.
+        frozen_func->fixed_size_mask.resize(in_variables.layout.size(), false);
+        out_variables.link_symbolic_literals(in_variables,
+                                             frozen_func->fixed_size_mask);
     }
 
     jit_freeze_pause(backend);
@@ -1870,7 +2004,7 @@ nb::object FunctionRecording::replay(nb::callable func,
                                      FrozenFunction *frozen_func,
                                      nb::dict input,
                                      const FlatVariables &in_variables) {
-    ProfilerPhase profiler("replay");
+    ProfilerPhase profiler("replay", &frozen_func->stats.replay);
 
     jit_log(LogLevel::Info, "Replaying:");
     int dryrun_success;
@@ -1882,6 +2016,7 @@ nb::object FunctionRecording::replay(nb::callable func,
     if (!dryrun_success) {
         // Dry run has failed. Re-record the function.
         jit_log(LogLevel::Info, "Dry run failed! re-recording");
+        frozen_func->stats.n_dry_run_failures++;
         this->clear();
         try {
             return this->record(func, frozen_func, input, in_variables);
@@ -1903,6 +2038,8 @@ nb::object FunctionRecording::replay(nb::callable func,
             jit_freeze_replay(recording, in_variables.variables.data(),
                               out_variables.variables.data());
         }
+        frozen_func->stats.n_replays++;
+        this->hits++;
     }
     jit_log(LogLevel::Info, "Replaying done:");
 
@@ -1912,11 +2049,15 @@ nb::object FunctionRecording::replay(nb::callable func,
         state_lock_guard guard;
         // Enter Resume scope, so we can track gradients
         ADScopeContext ad_scope(drjit::ADScope::Resume, 0, nullptr, -1, false);
+        // Literal outputs that forward an input literal are constructed from
+        // the current input
+        out_variables.forward_inputs = &in_variables;
         out_variables.layout_index = 0;
         try {
             ProfilerPhase profiler2("construct output");
             output = nb::borrow<nb::object>(out_variables.construct());
         } catch (std::exception &) {
+            out_variables.forward_inputs = nullptr;
             out_variables.release();
             throw;
         }
@@ -1925,9 +2066,11 @@ nb::object FunctionRecording::replay(nb::callable func,
             TraverseContext ctx;
             out_variables.assign_with_registry(input, ctx);
         } catch (std::exception &) {
+            out_variables.forward_inputs = nullptr;
             out_variables.release();
             throw;
         }
+        out_variables.forward_inputs = nullptr;
     }
 
     // out_variables is assigned by ``jit_record_replay``, which transfers
@@ -1939,7 +2082,8 @@ nb::object FunctionRecording::replay(nb::callable func,
 }
 
 nb::object FrozenFunction::operator()(nb::dict input) {
-    ProfilerPhase profiler("frozen function");
+    stats.begin_call();
+    ProfilerPhase profiler("frozen function", &stats.total);
     state_lock_guard guard;
     nb::object result;
     {
@@ -1952,7 +2096,7 @@ nb::object FrozenFunction::operator()(nb::dict input) {
         // function from another one, we simply record the inner function.
         if (!jit_flag(JitFlag::KernelFreezing) ||
             jit_flag(JitFlag::FreezingScope) || max_cache_size == 0) {
-            ProfilerPhase profiler2("function");
+            ProfilerPhase profiler2("function", &stats.function);
             state_unlock_guard guard2;
             return func(input);
         }
@@ -1973,7 +2117,7 @@ nb::object FrozenFunction::operator()(nb::dict input) {
                                      true);
 
             // Traverse input variables
-            ProfilerPhase profiler2("traverse input");
+            ProfilerPhase profiler2("traverse input", &stats.traverse_input);
 
             TraverseContext ctx;
             in_variables->traverse_with_registry(input, ctx);
@@ -1989,10 +2133,15 @@ nb::object FrozenFunction::operator()(nb::dict input) {
                     opaque_mask.resize(in_variables->layout.size());
                     for (uint32_t i2 = 0; i2 < opaque_mask.size(); i2++)
                         opaque_mask[i2] = false;
+                    fixed_size_mask.resize(in_variables->layout.size());
+                    for (uint32_t i2 = 0; i2 < fixed_size_mask.size(); i2++)
+                        fixed_size_mask[i2] = false;
                     jit_log(LogLevel::Debug, "auto-opaque incompatible");
                 }
-            } else
+            } else {
                 opaque_mask.resize(in_variables->layout.size(), false);
+                fixed_size_mask.resize(in_variables->layout.size(), false);
+            }
 
             in_variables->schedule_jit_variables(!this->auto_opaque,
                                                  &opaque_mask);
@@ -2002,13 +2151,14 @@ nb::object FrozenFunction::operator()(nb::dict input) {
             {
                 state_unlock_guard guard3;
                 { // Evaluate the variables, scheduled when traversing
-                    ProfilerPhase profiler3("eval");
+                    ProfilerPhase profiler3("eval", &stats.eval);
                     nb::gil_scoped_release guard2;
                     jit_eval();
                 }
             }
 
             in_variables->record_jit_variables();
+            in_variables->bind_symbolic_sizes(*in_variables, &fixed_size_mask);
             bool new_opaques = false;
             if (prev_key && auto_opaque_)
                 new_opaques =
@@ -2032,6 +2182,7 @@ nb::object FrozenFunction::operator()(nb::dict input) {
                 in_variables = std::make_shared<FlatVariables>(
                     FlatVariables(in_heuristics));
                 in_variables->flags = flags;
+                stats.n_auto_opaque_retraversals++;
             } else {
                 break;
             }
@@ -2061,6 +2212,7 @@ nb::object FrozenFunction::operator()(nb::dict input) {
                 }
             }
             recordings.erase(lru_it);
+            stats.n_evictions++;
 
             it = this->recordings.find(in_variables);
         }
@@ -2077,6 +2229,7 @@ nb::object FrozenFunction::operator()(nb::dict input) {
             // FunctionRecording recording;
             auto recording       = std::make_unique<FunctionRecording>();
             recording->last_used = call_counter - 1;
+            recording->id        = recording_counter;
 
             try {
                 result = recording->record(func, this, input, *in_variables);
@@ -2097,6 +2250,10 @@ nb::object FrozenFunction::operator()(nb::dict input) {
 
             in_variables->release();
 
+            // The recording may have excluded literal inputs from symbolic
+            // binding, which changes the key under which it is stored
+            in_variables->bind_symbolic_sizes(*in_variables, &fixed_size_mask);
+
             this->prev_key = in_variables;
             if (!jit_freeze_discarded(recording->recording))
                 this->recordings.insert(
@@ -2127,6 +2284,15 @@ void FrozenFunction::clear() {
     prev_key          = std::make_shared<FlatVariables>(FlatVariables());
     recording_counter = 0;
     call_counter      = 0;
+    stats             = FrozenFunctionStats();
+}
+
+FrozenFunctionStats FrozenFunction::snapshot_stats() {
+    FrozenFunctionStats result = stats;
+    result.hits = nb::dict();
+    for (auto &it : recordings)
+        result.hits[nb::int_(it.second->id)] = it.second->hits;
+    return result;
 }
 
 /**
@@ -2190,8 +2356,35 @@ void export_freeze(nb::module_ & /*m*/) {
             "n_cached_recordings",
             [](FrozenFunction &self) { return self.n_cached_recordings(); })
         .def_ro("n_recordings", &FrozenFunction::recording_counter)
+        .def_prop_ro("stats", &FrozenFunction::snapshot_stats)
         .def("clear", &FrozenFunction::clear)
         .def("__call__", &FrozenFunction::operator());
+
+    nb::class_<PhaseStats>(d, "FrozenPhaseStats")
+        .def_ro("total", &PhaseStats::total)
+        .def_ro("last", &PhaseStats::last)
+        .def_ro("count", &PhaseStats::count)
+        .def("__repr__", [](const PhaseStats &p) {
+            return nb::str("FrozenPhaseStats(total={:.3f} ms, last={:.3f} ms, "
+                           "count={})")
+                .format(p.total, p.last, p.count);
+        });
+
+    nb::class_<FrozenFunctionStats>(d, "FrozenFunctionStats")
+        .def_ro("traverse_input", &FrozenFunctionStats::traverse_input)
+        .def_ro("eval", &FrozenFunctionStats::eval)
+        .def_ro("function", &FrozenFunctionStats::function)
+        .def_ro("record", &FrozenFunctionStats::record)
+        .def_ro("replay", &FrozenFunctionStats::replay)
+        .def_ro("total", &FrozenFunctionStats::total)
+        .def_ro("n_calls", &FrozenFunctionStats::n_calls)
+        .def_ro("n_records", &FrozenFunctionStats::n_records)
+        .def_ro("n_replays", &FrozenFunctionStats::n_replays)
+        .def_ro("n_dry_run_failures", &FrozenFunctionStats::n_dry_run_failures)
+        .def_ro("n_auto_opaque_retraversals",
+                &FrozenFunctionStats::n_auto_opaque_retraversals)
+        .def_ro("n_evictions", &FrozenFunctionStats::n_evictions)
+        .def_ro("hits", &FrozenFunctionStats::hits);
 }
 
 #ifdef _MSC_VER
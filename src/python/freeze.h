@@ -98,6 +98,21 @@ struct Layout {
     /// we keep a reference to it.
     uint32_t literal_index = 0;
 
+    /// If this node represents a literal input variable, whose size matches
+    /// one of the size equivalence classes of the opaque input variables, this
+    /// field stores the index of that class plus one. The size of such
+    /// variables is then treated as a symbolic dimension, i.e. it is not part
+    /// of the key. Otherwise, this field is zero.
+    uint32_t size_index = 0;
+
+    /// If this node represents a literal output that is the same variable as a
+    /// literal input with a symbolic size (e.g., because the input was
+    /// returned or left unchanged), this field stores the position of that
+    /// input in the input layout plus one. When replaying, the literal of the
+    /// current input is used instead of the recorded one. Otherwise, this
+    /// field is zero.
+    uint32_t forward_index = 0;
+
     /// If a non drjit type is passed as function arguments or result, we simply
     /// cache it here.
     nb::object py_object;
@@ -110,7 +125,8 @@ struct Layout {
 
     Layout()
         : literal(0), fields(), num(0), index(0), flags(0), vt(0),
-          literal_index(0), py_object(), type() {};
+          literal_index(0), size_index(0), forward_index(0), py_object(),
+          type() {};
 
     Layout(const Layout &)            = delete;
     Layout &operator=(const Layout &) = delete;
@@ -211,6 +227,11 @@ struct FlatVariables {
     /// to construct size equivalence classes (i.e. deduplicating sizes).
     tsl::robin_map<uint32_t, uint32_t, UInt32Hasher> size_to_slot;
 
+    /// When replaying, this points to the flattened input of the current call.
+    /// It is used to construct literal outputs that forward an input literal
+    /// with a symbolic size (see ``Layout::forward_index``).
+    const FlatVariables *forward_inputs = nullptr;
+
     /// This saves information about the type, size and fields of pytree
     /// objects. The information is stored in DFS order.
     drjit::vector<Layout> layout;
@@ -342,6 +363,42 @@ struct FlatVariables {
      */
     void record_jit_variables();
 
+    /**
+     * \brief Binds the sizes of literal and undefined variables to symbolic
+     * dimensions.
+     *
+     * After calling ``record_jit_variables`` on the input, the sizes of the
+     * opaque input variables are grouped into equivalence classes. Literal
+     * variables, whose size matches one of these classes (\c dims), are
+     * marked with its index. Their size then no longer has to match exactly
+     * when looking up a recording. Variables of size 1 are excluded, since
+     * they are broadcast rather than indexed in the generated kernels.
+     * Undefined variables are excluded as well, since the recording allocates
+     * them with a fixed size when they are written to.
+     *
+     * This is only applied to inputs. Positions set in \c fixed_mask are not
+     * bound (see ``link_symbolic_literals``).
+     */
+    void bind_symbolic_sizes(const FlatVariables &dims,
+                             const drjit::vector<bool> *fixed_mask);
+
+    /**
+     * \brief Checks which literal outputs depend on the symbolic sizes of the
+     * input literals in \c in.
+     *
+     * The size of a literal output is baked into the recording. If the output
+     * is the same variable as a bound input literal, it is marked with
+     * ``Layout::forward_index`` and re-created from the current input when
+     * replaying. Any other literal or undefined output, whose size matches a
+     * bound input literal, may have been computed from it (e.g., ``y * 2``
+     * is folded into a new literal). The positions of such inputs are set in
+     * \c fixed_mask, so that their size is part of the key in the future.
+     *
+     * Returns \c true if new positions were added to \c fixed_mask.
+     */
+    bool link_symbolic_literals(const FlatVariables &in,
+                                drjit::vector<bool> &fixed_mask);
+
     /**
      * Returns a struct representing heuristics to pre-allocate memory for the
      * layout, of the flat variables. This accelerates subsequent traversals and
@@ -544,6 +601,14 @@ struct FunctionRecording {
     /// will be used to evict the least recently used recording.
     uint32_t last_used   = 0;
 
+    /// Identifier of this recording, corresponding to the value of the \c
+    /// recording_counter of the frozen function when it was first recorded.
+    /// This is used to report per-key statistics.
+    uint32_t id          = 0;
+
+    /// The number of times this recording has been successfully replayed.
+    uint32_t hits        = 0;
+
     /// The opaque JIT recording, that has been recorded with \c
     /// jit_freeze_start and \c jit_freeze_stop, and is held by this wrapper.
     Recording *recording = nullptr;
@@ -593,6 +658,74 @@ using RecordingMap = tsl::robin_map<std::shared_ptr<FlatVariables>,
                                     std::unique_ptr<FunctionRecording>,
                                     FlatVariablesHasher, FlatVariablesEqual>;
 
+/// Timing information about one phase of a frozen function call
+struct PhaseStats {
+    /// Cumulative time spent in this phase (in milliseconds)
+    double total = 0.0;
+
+    /// Time spent in this phase during the most recent call to the frozen
+    /// function (in milliseconds). Phases that are entered multiple times per
+    /// call (e.g. when the input is traversed again) are accumulated.
+    double last  = 0.0;
+
+    /// The number of times this phase has been entered
+    uint32_t count = 0;
+
+    void add(double time) {
+        total += time;
+        last  += time;
+        count++;
+    }
+};
+
+/**
+ * \brief Statistics collected by a \c FrozenFunction.
+ *
+ * These can be queried from Python to detect situations where the frozen
+ * function unexpectedly falls back to re-recording.
+ */
+struct FrozenFunctionStats {
+    /// Time spent traversing the input PyTree
+    PhaseStats traverse_input;
+    /// Time spent evaluating the input variables
+    PhaseStats eval;
+    /// Time spent executing the Python function (when recording, or when
+    /// freezing is disabled)
+    PhaseStats function;
+    /// Time spent recording the function (including ``function``)
+    PhaseStats record;
+    /// Time spent replaying the function (including failed dry-runs)
+    PhaseStats replay;
+    /// Time spent in the call operator of the frozen function overall
+    PhaseStats total;
+
+    /// The number of calls to the frozen function
+    uint32_t n_calls                    = 0;
+    /// The number of times the function was recorded
+    uint32_t n_records                  = 0;
+    /// The number of times a recording was successfully replayed
+    uint32_t n_replays                  = 0;
+    /// The number of times a dry-run failed, causing a re-recording
+    uint32_t n_dry_run_failures         = 0;
+    /// The number of times the input had to be traversed again, because the
+    /// auto-opaque feature discovered new literals that should be made opaque
+    uint32_t n_auto_opaque_retraversals = 0;
+    /// The number of recordings evicted due to the \c max_cache_size limit
+    uint32_t n_evictions                = 0;
+
+    /// Maps the identifier of each cached recording to the number of times it
+    /// has been replayed. Only populated in snapshots returned to Python.
+    nb::dict hits;
+
+    /// Reset the \c last field of all phases at the start of a new call
+    void begin_call() {
+        for (PhaseStats *p : { &traverse_input, &eval, &function, &record,
+                               &replay, &total })
+            p->last = 0.0;
+        n_calls++;
+    }
+};
+
 } // namespace detail
 
 struct FrozenFunction {
@@ -611,6 +744,11 @@ struct FrozenFunction {
     /// made opaque before calling the function.
     drjit::vector<bool> opaque_mask;
 
+    /// Tags literal inputs whose size may reach a literal output, and which
+    /// must therefore not be bound to a symbolic dimension (see
+    /// ``FlatVariables::link_symbolic_literals``).
+    drjit::vector<bool> fixed_size_mask;
+
     /// The number of times this function has been recorded. Note, this can
     /// differ from the number of recordings actually cached in \c recordings,
     /// when dry running recordings failed.
@@ -644,6 +782,9 @@ struct FrozenFunction {
     /// Pre-allocating these vectors helps with performance.
     detail::FlatVariables::Heuristic in_heuristics;
 
+    /// Timing and hit/miss statistics of this frozen function
+    detail::FrozenFunctionStats stats;
+
     FrozenFunction(nb::callable func, int max_cache_size = -1,
                    uint32_t warn_recording_count = 10,
                    JitBackend backend            = JitBackend::None,
@@ -664,6 +805,9 @@ struct FrozenFunction {
     /// Clears the frozen function recordings and resets the counters.
     void clear();
 
+    /// Returns a snapshot of the statistics, including per-recording hits.
+    detail::FrozenFunctionStats snapshot_stats();
+
     /// Operator to call the frozen function and either record a new version or
     /// replay an old one. It expects a dictionary input, containing the args,
     /// kwargs and closure of the Python function.
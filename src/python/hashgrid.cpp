@@ -0,0 +1,81 @@
+/*
+    hashgrid.cpp -- Python bindings for the fused hash grid encoding
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include "hashgrid.h"
+#include "base.h"
+#include <drjit/autodiff.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+
+using LevelTuple = std::tuple<double, uint32_t, uint32_t, uint32_t>;
+
+static nb::list hashgrid_encode(nb::handle_t<dr::ArrayBase> data,
+                                nb::sequence pos, uint32_t n_features,
+                                const std::vector<LevelTuple> &levels,
+                                double pos_offset,
+                                nb::handle_t<dr::ArrayBase> active) {
+    nb::handle tp = data.type();
+    const ArraySupplement &s = supp(tp);
+
+    VarType vt = (VarType) s.type;
+    if (s.ndim != 1 || s.backend == (uint8_t) JitBackend::None ||
+        (vt != VarType::Float16 && vt != VarType::Float32 &&
+         vt != VarType::Float64))
+        nb::raise("drjit.detail.hashgrid_encode(): 'data' must be a flat "
+                  "JIT-compiled floating point array.");
+
+    const ArraySupplement &s_active = supp(active.type());
+    if (s_active.ndim != 1 || s_active.type != (uint8_t) VarType::Bool ||
+        s_active.backend != s.backend)
+        nb::raise("drjit.detail.hashgrid_encode(): 'active' must be a mask "
+                  "array of the same backend as 'data'.");
+
+    // Positions are treated as non-differentiable
+    size_t dimension = nb::len(pos);
+    dr::vector<uint32_t> pos_indices(dimension);
+    for (size_t i = 0; i < dimension; ++i) {
+        nb::handle p = pos[i];
+        if (!is_drjit_array(p) || supp(p.type()).ndim != 1 ||
+            supp(p.type()).backend != s.backend)
+            nb::raise("drjit.detail.hashgrid_encode(): 'pos' must be a "
+                      "sequence of flat arrays of the same backend as 'data'.");
+        pos_indices[i] = (uint32_t) supp(p.type()).index(inst_ptr(p));
+    }
+
+    dr::vector<HashGridLevel> level_descr(levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        auto [scale, resolution, offset, size] = levels[i];
+        level_descr[i] = HashGridLevel{ scale, resolution, offset, size };
+    }
+
+    size_t n_out = levels.size() * n_features;
+    dr::vector<uint64_t> out(n_out, 0);
+    ad_hashgrid_encode(s.index(inst_ptr(data)), n_features,
+                       (uint32_t) dimension, pos_indices.data(), pos_offset,
+                       (uint32_t) levels.size(), level_descr.data(),
+                       (uint32_t) s_active.index(inst_ptr(active)),
+                       out.data());
+
+    nb::list result;
+    for (size_t i = 0; i < n_out; ++i) {
+        nb::object o = nb::inst_alloc(tp);
+        s.init_index(out[i], inst_ptr(o));
+        nb::inst_mark_ready(o);
+        ad_var_dec_ref(out[i]);
+        result.append(o);
+    }
+
+    return result;
+}
+
+void export_hashgrid(nb::module_ &detail) {
+    detail.def("hashgrid_encode", &hashgrid_encode, "data"_a, "pos"_a,
+               "n_features"_a, "levels"_a, "pos_offset"_a, "active"_a);
+}
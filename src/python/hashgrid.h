@@ -0,0 +1,15 @@
+/*
+    hashgrid.h -- Python bindings for the fused hash grid encoding
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+#include "common.h"
+
+extern void export_hashgrid(nb::module_ &detail);
@@ -60,6 +60,7 @@ void set_label(nb::handle h, nb::str label) {
         if ((JitBackend) s.backend == JitBackend::None)
             return;
         if (s.is_tensor) {
+            s.tensor_materialize(inst_ptr(h));
             set_label(nb::steal(s.tensor_array(h.ptr())), label);
             return;
         } else if (s.ndim == 1) {
@@ -13,6 +13,7 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/intrusive/counter.h>
 #include "bind.h"
+#include "apply.h"
 #include "base.h"
 #include "shape.h"
 #include "log.h"
@@ -41,8 +42,10 @@
 #include "tracker.h"
 #include "local.h"
 #include "resample.h"
+#include "matmul.h"
 #include "coop_vec.h"
 #include "reorder.h"
+#include "hashgrid.h"
 #include "quat.h"
 
 static int active_backend = -1;
@@ -177,6 +180,10 @@ NB_MODULE(_drjit_ext, m_) {
         .value("Clamp", dr::WrapMode::Clamp)
         .value("Mirror", dr::WrapMode::Mirror);
 
+    nb::enum_<dr::TextureLayout>(m, "TextureLayout")
+        .value("RowMajor", dr::TextureLayout::RowMajor)
+        .value("Tiled", dr::TextureLayout::Tiled);
+
     m.def("has_backend", &jit_has_backend, doc_has_backend);
 
     m.def("sync_thread", &jit_sync_thread, doc_sync_thread, nb::call_guard<nb::gil_scoped_release>())
@@ -238,7 +245,9 @@ NB_MODULE(_drjit_ext, m_) {
     python_cleanup_thread_static_initialization();
     nb::module_::import_("atexit").attr("register")(nb::cpp_function([]() {
         dr::sync_thread(); // Finish any ongoing Dr.Jit computations.
+        flush_print(); // Output deferred symbolic print statements.
         python_cleanup_thread_static_shutdown();
+        traverse_plan_clear();
     }));
 
     export_bind(detail);
@@ -266,7 +275,9 @@ NB_MODULE(_drjit_ext, m_) {
     export_tracker(detail);
     export_local(m);
     export_resample(m);
+    export_matmul(detail);
     export_reorder(m);
+    export_hashgrid(detail);
     export_quat(m);
 
     export_scalar(scalar);
@@ -0,0 +1,36 @@
+/*
+    matmul.cpp -- Python bindings for the blocked CPU matrix multiplication
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <drjit/matmul.h>
+#include "matmul.h"
+
+template <typename Array> static void bind_matmul(nb::module_ &m) {
+    m.def(
+        "matmul",
+        [](uint32_t batch, uint32_t m, uint32_t n, uint32_t k, const Array &a,
+           size_t a_batch_stride, bool a_trans, const Array &b,
+           size_t b_batch_stride, bool b_trans) {
+            return dr::matmul(batch, m, n, k, a, a_batch_stride, a_trans, b,
+                              b_batch_stride, b_trans);
+        },
+        "batch"_a, "m"_a, "n"_a, "k"_a, "a"_a.noconvert(), "a_batch_stride"_a,
+        "a_trans"_a, "b"_a.noconvert(), "b_batch_stride"_a, "b_trans"_a,
+        nb::call_guard<nb::gil_scoped_release>());
+}
+
+void export_matmul(nb::module_ &m) {
+    bind_matmul<dr::DynamicArray<float>>(m);
+    bind_matmul<dr::DynamicArray<double>>(m);
+
+#if defined(DRJIT_ENABLE_LLVM)
+    bind_matmul<dr::LLVMArray<float>>(m);
+    bind_matmul<dr::LLVMArray<double>>(m);
+#endif
+}
@@ -0,0 +1,13 @@
+/*
+    matmul.h -- Python bindings for the blocked CPU matrix multiplication
+
+    Dr.Jit: A Just-In-Time-Compiler for Differentiable Rendering
+    Copyright 2023, Realistic Graphics Lab, EPFL.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include "common.h"
+
+extern void export_matmul(nb::module_ &detail);
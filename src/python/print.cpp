@@ -22,6 +22,8 @@
 #include <drjit/autodiff.h>
 #include <memory>
 #include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 #include "../ext/nanobind/src/buffer.h"
 
@@ -275,7 +277,40 @@ void repr_general(Buffer &buffer, nb::handle h, size_t indent_, size_t threshold
 // Forward declaration
 static nb::object format_impl(const char *name, const std::string &fmt,
                               nb::handle file, nb::args args,
-                              nb::kwargs kwargs, bool internal = false);
+                              nb::kwargs kwargs, bool internal = false,
+                              double rate_limit = 0.0, bool defer = false);
+
+struct DelayedPrint;
+
+/// Symbolic print statements with ``defer=True`` that await output
+static std::vector<DelayedPrint *> *pending_prints = nullptr;
+
+/// Flush deferred print statements once this many of them are pending
+static constexpr size_t max_pending_prints = 256;
+
+/// Time of the last output of rate-limited print statements (by format string)
+static std::unordered_map<std::string, double> *print_last_output = nullptr;
+
+/// Check if a print statement exceeds its rate limit (in outputs per second)
+static bool rate_limited(const std::string &fmt, double rate_limit) {
+    if (!(rate_limit > 0.0))
+        return false;
+
+    double now = std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    if (!print_last_output)
+        print_last_output = new std::unordered_map<std::string, double>();
+
+    auto [it, inserted] = print_last_output->try_emplace(fmt, now);
+    if (!inserted) {
+        if (now - it->second < 1.0 / rate_limit)
+            return true;
+        it->second = now;
+    }
+
+    return false;
+}
 
 struct DelayedPrint {
     std::string fmt;
@@ -284,7 +319,8 @@ struct DelayedPrint {
     size_t limit;
     nb::args args;
     nb::kwargs kwargs;
-    bool success = false;
+    double rate_limit = 0.0;
+    bool defer = false;
 
     static void callback(uint32_t, int free, void *p) {
         nb::gil_scoped_acquire guard;
@@ -294,71 +330,19 @@ struct DelayedPrint {
                 delete d;
                 return;
             }
-            nb::object tid_o = d->kwargs["thread_id"];
-            nb::handle tp = tid_o.type();
-            const ArraySupplement &s = supp(tp);
-
-            size_t ctr_size = nb::cast<size_t>(d->counter[0]),
-                   max_size = nb::len(tid_o),
-                   size     = std::min(max_size, ctr_size);
-
-            void *ptr = nullptr;
-            uint32_t tid_index =
-                jit_var_data((uint32_t) s.index(inst_ptr(tid_o)), &ptr);
-
-            std::unique_ptr<uint32_t[]> ids(new uint32_t[size]);
-            jit_memcpy((JitBackend) s.backend, ids.get(), ptr,
-                       size * sizeof(uint32_t));
-            jit_var_dec_ref(tid_index);
-
-            std::unique_ptr<uint32_t[]> perm(new uint32_t[size]);
-            for (size_t i = 0; i < size; ++i)
-                perm[i] = (uint32_t) i;
-
-            std::stable_sort(
-                perm.get(), perm.get() + size,
-                [&ids](uint32_t i0, uint32_t i1) { return ids[i0] < ids[i1]; });
-
-            uint32_t perm_index =
-                jit_var_mem_copy((JitBackend) s.backend, AllocType::Host,
-                                 VarType::UInt32, perm.get(), size);
-
-            nb::object perm_o = nb::inst_alloc(tp);
-            s.init_index(perm_index, inst_ptr(perm_o));
-            jit_var_dec_ref(perm_index);
-            nb::inst_mark_ready(perm_o);
-
-            struct PermuteData : TransformCallback {
-                nb::object perm_o;
-                PermuteData(nb::object perm_o) : perm_o(perm_o) { }
-
-                void operator()(nb::handle h1, nb::handle h2) override {
-                    nb::object o =
-                        gather(nb::borrow<nb::type_object>(h1.type()),
-                               nb::borrow(h1), perm_o, nb::cast(true));
-                    nb::inst_replace_move(h2, o);
-                }
-            };
 
-            PermuteData rd(perm_o);
-            d->args = nb::borrow<nb::args>(transform("drjit.print", rd, d->args));
-            d->kwargs = nb::borrow<nb::kwargs>(transform("drjit.print", rd, d->kwargs));
-            d->kwargs["limit"] = nb::cast(d->limit);
-
-            format_impl("drjit.print", d->fmt, d->file, d->args, d->kwargs, true);
-
-            if (ctr_size > max_size) {
-                PyErr_WarnFormat(
-                    PyExc_RuntimeWarning, 1,
-                    "dr.print(): symbolic print statement only captured "
-                    "%zu of %zu available outputs. The above is a "
-                    "nondeterministic sample, in which entries are in the "
-                    "right order but not necessarily contiguous. Specify "
-                    "`limit=..` to capture more information and/or add the "
-                    "special format field `{thread_id}` show the thread "
-                    "ID/array index associated with each entry of the captured "
-                    "output.", max_size, ctr_size);
+            if (d->defer) {
+                /* Don't wait for the kernel here. Keep a reference to the
+                   captured buffers and fetch them when flush_print() runs */
+                if (!pending_prints)
+                    pending_prints = new std::vector<DelayedPrint *>();
+                pending_prints->push_back(new DelayedPrint(*d));
+                if (pending_prints->size() >= max_pending_prints)
+                    flush_print();
+                return;
             }
+
+            d->output();
         } catch (nb::python_error &e) {
             e.restore();
             nb::chain_error(PyExc_RuntimeError,
@@ -367,12 +351,99 @@ struct DelayedPrint {
             nb::chain_error(PyExc_RuntimeError, "drjit.print(): %s", e.what());
         }
     }
+
+    /// Fetch the captured data from the device and print it
+    void output() {
+        // Drop the output without synchronizing with the device
+        if (rate_limited(fmt, rate_limit))
+            return;
+
+        nb::object tid_o = kwargs["thread_id"];
+        nb::handle tp = tid_o.type();
+        const ArraySupplement &s = supp(tp);
+
+        size_t ctr_size = nb::cast<size_t>(counter[0]),
+               max_size = nb::len(tid_o),
+               size     = std::min(max_size, ctr_size);
+
+        void *ptr = nullptr;
+        uint32_t tid_index =
+            jit_var_data((uint32_t) s.index(inst_ptr(tid_o)), &ptr);
+
+        std::unique_ptr<uint32_t[]> ids(new uint32_t[size]);
+        jit_memcpy((JitBackend) s.backend, ids.get(), ptr,
+                   size * sizeof(uint32_t));
+        jit_var_dec_ref(tid_index);
+
+        std::unique_ptr<uint32_t[]> perm(new uint32_t[size]);
+        for (size_t i = 0; i < size; ++i)
+            perm[i] = (uint32_t) i;
+
+        std::stable_sort(
+            perm.get(), perm.get() + size,
+            [&ids](uint32_t i0, uint32_t i1) { return ids[i0] < ids[i1]; });
+
+        uint32_t perm_index =
+            jit_var_mem_copy((JitBackend) s.backend, AllocType::Host,
+                             VarType::UInt32, perm.get(), size);
+
+        nb::object perm_o = nb::inst_alloc(tp);
+        s.init_index(perm_index, inst_ptr(perm_o));
+        jit_var_dec_ref(perm_index);
+        nb::inst_mark_ready(perm_o);
+
+        struct PermuteData : TransformCallback {
+            nb::object perm_o;
+            PermuteData(nb::object perm_o) : perm_o(perm_o) { }
+
+            void operator()(nb::handle h1, nb::handle h2) override {
+                nb::object o =
+                    gather(nb::borrow<nb::type_object>(h1.type()),
+                           nb::borrow(h1), perm_o, nb::cast(true));
+                nb::inst_replace_move(h2, o);
+            }
+        };
+
+        PermuteData rd(perm_o);
+        args = nb::borrow<nb::args>(transform("drjit.print", rd, args));
+        kwargs = nb::borrow<nb::kwargs>(transform("drjit.print", rd, kwargs));
+        kwargs["limit"] = nb::cast(limit);
+
+        format_impl("drjit.print", fmt, file, args, kwargs, true);
+
+        if (ctr_size > max_size) {
+            PyErr_WarnFormat(
+                PyExc_RuntimeWarning, 1,
+                "dr.print(): symbolic print statement only captured "
+                "%zu of %zu available outputs. The above is a "
+                "nondeterministic sample, in which entries are in the "
+                "right order but not necessarily contiguous. Specify "
+                "`limit=..` to capture more information and/or add the "
+                "special format field `{thread_id}` show the thread "
+                "ID/array index associated with each entry of the captured "
+                "output.", max_size, ctr_size);
+        }
+    }
 };
 
+void flush_print() {
+    if (!pending_prints || pending_prints->empty())
+        return;
+
+    std::vector<std::unique_ptr<DelayedPrint>> todo;
+    for (DelayedPrint *d : *pending_prints)
+        todo.emplace_back(d);
+    pending_prints->clear();
+
+    for (std::unique_ptr<DelayedPrint> &d : todo)
+        d->output();
+}
+
 // Central formatting routine used by drjit.print() and drjit.format()
 static nb::object format_impl(const char *name, const std::string &fmt,
                               nb::handle file, nb::args args,
-                              nb::kwargs kwargs, bool internal) {
+                              nb::kwargs kwargs, bool internal,
+                              double rate_limit, bool defer) {
     try {
         // Check if the input contains symbolic variables, and whether they are compatible in that case
         struct Examine : TraverseCallback {
@@ -513,11 +584,15 @@ static nb::object format_impl(const char *name, const std::string &fmt,
                     std::move(counter),
                     limit,
                     nb::borrow<nb::args>(transform(name, capture, args)),
-                    nb::borrow<nb::kwargs>(transform(name, capture, kwargs)) });
+                    nb::borrow<nb::kwargs>(transform(name, capture, kwargs)),
+                    rate_limit, defer });
 
             return nb::none();
         }
 
+        if (rate_limited(fmt, rate_limit))
+            return nb::none();
+
         schedule(args);
         schedule(kwargs);
         Buffer buffer(128);
@@ -723,7 +798,20 @@ void print_impl(const std::string &fmt, nb::args args, nb::kwargs kwargs) {
         end = "\n";
     }
 
-    format_impl("drjit.print", fmt + end, file, args, kwargs);
+    double rate_limit = 0.0;
+    if (kwargs.contains("rate_limit")) {
+        rate_limit = nb::cast<double>(kwargs["rate_limit"]);
+        nb::del(kwargs["rate_limit"]);
+    }
+
+    bool defer = false;
+    if (kwargs.contains("defer")) {
+        defer = nb::cast<bool>(kwargs["defer"]);
+        nb::del(kwargs["defer"]);
+    }
+
+    format_impl("drjit.print", fmt + end, file, args, kwargs, false,
+                rate_limit, defer);
 }
 
 void export_print(nb::module_ &m) {
@@ -745,7 +833,8 @@ void export_print(nb::module_ &m) {
            doc_print,
            nb::sig("def print(fmt: str, *args, active: drjit.ArrayBase | "
                          "bool = True, end: str = '\\n', file: object = None, "
-                         "limit: int = 20, mode='auto', **kwargs) -> None"))
+                         "limit: int = 20, mode='auto', defer: bool = False, "
+                         "rate_limit: float = 0, **kwargs) -> None"))
       .def(
           "print",
           [](nb::object value, nb::kwargs kwargs) {
@@ -754,5 +843,7 @@ void export_print(nb::module_ &m) {
           "value"_a.none(), "kwargs"_a,
           nb::sig("def print(value: object, /, active: drjit.ArrayBase | "
                         "bool = True, end: str = '\\n', file: object = None, "
-                        "limit: int = 20, mode='auto', **kwargs) -> None"));
+                        "limit: int = 20, mode='auto', defer: bool = False, "
+                        "rate_limit: float = 0, **kwargs) -> None"))
+      .def("flush_print", &flush_print, doc_flush_print);
 }
@@ -16,3 +16,6 @@
 extern void export_print(nb::module_&);
 
 extern PyObject *tp_repr(PyObject *self) noexcept;
+
+/// Print the output of deferred symbolic print statements
+extern void flush_print();
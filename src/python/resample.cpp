@@ -81,6 +81,12 @@ void export_resample(nb::module_ &) {
          .def("resample_fwd",
               (dr::DynamicArray<double>(Resampler::*)(const dr::DynamicArray<double> &, uint32_t) const) &Resampler::resample_fwd,
               "source"_a.noconvert(), "stride"_a)
+         .def_static("resample_2d_fwd", &Resampler::resample_2d_fwd<dr::half>,
+              "res_y"_a, "res_x"_a, "source"_a.noconvert(), "channels"_a)
+         .def_static("resample_2d_fwd", &Resampler::resample_2d_fwd<float>,
+              "res_y"_a, "res_x"_a, "source"_a.noconvert(), "channels"_a)
+         .def_static("resample_2d_fwd", &Resampler::resample_2d_fwd<double>,
+              "res_y"_a, "res_x"_a, "source"_a.noconvert(), "channels"_a)
          .def_prop_ro("source_res", &Resampler::source_res)
          .def_prop_ro("target_res", &Resampler::target_res)
          .def("__repr__",
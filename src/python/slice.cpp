@@ -45,7 +45,8 @@ inline bool is_unsigned_int(VarType vt) {
 
 std::pair<nb::tuple, nb::object>
 slice_index(const nb::type_object_t<ArrayBase> &dtype,
-            const nb::tuple &shape, const nb::tuple &indices) {
+            const nb::tuple &shape, const nb::tuple &indices,
+            const int64_t *strides, size_t offset) {
     const ArraySupplement &s = supp(dtype);
 
     if (s.ndim != 1 || s.shape[0] != DRJIT_DYNAMIC ||
@@ -172,46 +173,171 @@ slice_index(const nb::type_object_t<ArrayBase> &dtype,
         size_out *= size;
     }
 
+    if (size_out == 0)
+        return { nb::tuple(shape_out), dtype() };
+
+    /* Compute 'offset + sum_i stride_i * coordinate_i', where the coordinate
+       of each output entry along axis 'i' is recovered from a single linear
+       index via division/modulo. Axes with one entry don't need this step,
+       and the contribution of integer indices and slice starts is folded
+       into a single constant. The resulting expression is only evaluated as
+       part of the consuming gather. */
+    size_t outer = 0;
+    while (outer + 1 < components.size() &&
+           components[outer].slice_size == 1)
+        outer++;
+
     nb::object index = arange(dtype, 0, size_out, 1),
-               index_out;
+               index_out, active = nb::borrow(Py_True);
+    int64_t index_const = (int64_t) offset, stride = 1;
 
-    nb::object active = nb::borrow(Py_True);
-    if (size_out) {
-        size_out = 1;
-        index_out = dtype(0);
+    for (size_t i = components.size(); i-- > 0; ) {
+        const Component &c = components[i];
+        if (strides)
+            stride = strides[i];
 
-        for (auto it = components.rbegin(); it != components.rend(); ++it) {
-            const Component &c = *it;
-            nb::object index_next, index_rem;
+        if (c.slice_size == 1 && !c.object.is_valid()) {
+            index_const += c.start * stride;
+        } else {
+            nb::object index_rem;
 
-            if (it + 1 != components.rend()) {
-                index_next = index.floor_div(dtype(c.slice_size));
-                index_rem = fma(index_next, dtype(uint32_t(-c.slice_size)), index);
-            } else {
+            if (c.slice_size == 1) {
+                index_rem = dtype(0);
+            } else if (i == outer) {
                 index_rem = index;
+            } else {
+                nb::object index_next = index.floor_div(dtype(c.slice_size));
+                index_rem = fma(index_next, dtype(uint32_t(-c.slice_size)), index);
+                index = std::move(index_next);
             }
 
             nb::object index_val;
-            if (!c.object.is_valid())
-                index_val = fma(index_rem, dtype(uint32_t(c.step * size_out)),
-                                dtype(uint32_t(c.start * size_out)));
-            else
+            if (!c.object.is_valid()) {
+                index_const += c.start * stride;
+                int64_t scale = c.step * stride;
+                index_val = scale == 1 ? index_rem
+                                       : index_rem * dtype(uint32_t(scale));
+            } else {
                 index_val = gather(dtype, c.object, index_rem, active,
-                                   ReduceMode::Auto) *
-                            dtype(uint32_t(size_out));
-
-            index_out += index_val;
+                                   ReduceMode::Auto);
+                if (stride != 1)
+                    index_val = index_val * dtype(uint32_t(stride));
+            }
 
-            index = std::move(index_next);
-            size_out *= c.size;
+            index_out = index_out.is_valid() ? index_out + index_val
+                                             : std::move(index_val);
         }
-    } else {
-        index_out = dtype();
+
+        if (!strides)
+            stride *= c.size;
     }
 
+    // Negative strides wrap around in 32-bit arithmetic
+    if (!index_out.is_valid())
+        index_out = dtype(uint32_t(index_const));
+    else if (index_const != 0)
+        index_out = index_out + dtype(uint32_t(index_const));
+
     return { nb::tuple(shape_out), index_out };
 }
 
+std::pair<dr::vector<int64_t>, size_t> tensor_layout(nb::handle h) {
+    const ArraySupplement &s = supp(h.type());
+    if (!s.is_tensor)
+        nb::raise_type_error("drjit.detail.tensor_layout(): expected a tensor!");
+
+    dr::vector<int64_t> strides(s.tensor_shape(inst_ptr(h)).size(), 0);
+    size_t offset = s.tensor_layout(inst_ptr(h), strides.data());
+    return { strides, offset };
+}
+
+nb::object tensor_view(nb::handle h, const dr::vector<size_t> &shape,
+                       const dr::vector<int64_t> &strides, size_t offset) {
+    nb::handle tp = h.type();
+    const ArraySupplement &s = supp(tp);
+    if (!s.is_tensor)
+        nb::raise_type_error("drjit.detail.tensor_view(): expected a tensor!");
+    if (shape.size() != strides.size())
+        nb::raise("drjit.detail.tensor_view(): 'shape' and 'strides' must "
+                  "have the same size!");
+
+    nb::object result = nb::inst_alloc(tp);
+    s.tensor_view(inst_ptr(h), shape.size(), shape.data(), strides.data(),
+                  offset, inst_ptr(result));
+    nb::inst_mark_ready(result);
+    return result;
+}
+
+/**
+ * Try to realize the tensor slice ``self[key]`` as a strided view that
+ * references the storage of ``self``. This is possible when the key only
+ * consists of integers, slices, ``None``, and ``...``. Returns an invalid
+ * object otherwise, or when the key is malformed (in which case the general
+ * implementation based on ``slice_index()`` reports the error).
+ */
+static nb::object slice_view(nb::handle self, const ArraySupplement &s,
+                             const nb::tuple &key) {
+    const dr::vector<size_t> &shape = s.tensor_shape(inst_ptr(self));
+    size_t ndim = shape.size(), true_indices = 0, ellipsis_count = 0;
+
+    for (nb::handle h : key) {
+        nb::handle tp = h.type();
+        if (tp.is(&PyLong_Type) || tp.is(&PySlice_Type))
+            true_indices++;
+        else if (tp.is(&PyEllipsis_Type))
+            ellipsis_count++;
+        else if (!h.is_none())
+            return nb::object();
+    }
+
+    if (ellipsis_count > 1 || true_indices > ndim)
+        return nb::object();
+
+    dr::vector<int64_t> strides(ndim, 0), strides_out;
+    dr::vector<size_t> shape_out;
+    int64_t offset = (int64_t) s.tensor_layout(inst_ptr(self), strides.data());
+    size_t axis = 0;
+
+    for (nb::handle h : key) {
+        nb::handle tp = h.type();
+
+        if (h.is_none()) {
+            shape_out.push_back(1);
+            strides_out.push_back(0);
+        } else if (tp.is(&PyEllipsis_Type)) {
+            for (size_t i = true_indices; i < ndim; ++i, ++axis) {
+                shape_out.push_back(shape[axis]);
+                strides_out.push_back(strides[axis]);
+            }
+        } else if (tp.is(&PyLong_Type)) {
+            Py_ssize_t size = (Py_ssize_t) shape[axis],
+                       v = nb::cast<Py_ssize_t>(h);
+            if (v < 0)
+                v += size;
+            if (v < 0 || v >= size)
+                return nb::object();
+            offset += (int64_t) v * strides[axis++];
+        } else {
+            Py_ssize_t start, stop, step;
+            size_t slice_length;
+            nb::detail::slice_compute(h.ptr(), (Py_ssize_t) shape[axis], start,
+                                      stop, step, slice_length);
+            if (slice_length)
+                offset += (int64_t) start * strides[axis];
+            shape_out.push_back(slice_length);
+            strides_out.push_back((int64_t) step * strides[axis++]);
+        }
+    }
+
+    // Implicit ellipsis at the end
+    for (; axis < ndim; ++axis) {
+        shape_out.push_back(shape[axis]);
+        strides_out.push_back(strides[axis]);
+    }
+
+    return tensor_view(self, shape_out, strides_out, (size_t) offset);
+}
+
 PyObject *mp_subscript(PyObject *self, PyObject *key) noexcept {
     nb::handle self_tp = nb::handle(self).type(),
                key_tp = nb::handle(key).type();
@@ -264,11 +390,23 @@ PyObject *mp_subscript(PyObject *self, PyObject *key) noexcept {
             else
                 key2 = nb::make_tuple(nb::handle(key));
 
+            // Basic slicing produces views that don't copy memory
+            nb::object view = slice_view(self, s, key2);
+            if (view.is_valid())
+                return view.release().ptr();
+
+            /* Advanced indexing: compute storage indices using the strides
+               of 'self', so that views aren't materialized before the gather */
+            size_t ndim = s.tensor_shape(inst_ptr(self)).size();
+            dr::vector<int64_t> strides(ndim, 0);
+            size_t offset = s.tensor_layout(inst_ptr(self), strides.data());
+
             auto [out_shape, out_index] = slice_index(
                 nb::borrow<nb::type_object_t<ArrayBase>>(s.tensor_index),
-                nb::borrow<nb::tuple>(shape(self)), key2);
+                nb::borrow<nb::tuple>(shape(self)), key2, strides.data(),
+                offset);
 
-            nb::object source = nb::steal(s.tensor_array(self));
+            nb::object source = nb::steal(s.tensor_storage(self));
 
             nb::object out = gather(nb::borrow<nb::type_object>(s.array),
                                     source, out_index, nb::borrow(Py_True));
@@ -430,6 +568,7 @@ int mp_ass_subscript(PyObject *self, PyObject *key, PyObject *value) noexcept {
                 nb::borrow<nb::type_object_t<ArrayBase>>(s.tensor_index),
                 nb::borrow<nb::tuple>(shape(self)), key2);
 
+            s.tensor_materialize(inst_ptr(self));
             nb::object target = nb::steal(s.tensor_array(self));
             scatter(target, nb::borrow(value), out_index, nb::borrow(Py_True));
 
@@ -549,6 +688,9 @@ int sq_ass_item_tensor(PyObject *self, Py_ssize_t index, PyObject *value) noexce
 }
 
 void export_slice(nb::module_&m) {
-    m.def("slice_index", &slice_index, doc_slice_index, "dtype"_a, "shape"_a,
-          "indices"_a);
+    m.def("slice_index",
+          [](const nb::type_object_t<ArrayBase> &dtype, const nb::tuple &shape,
+             const nb::tuple &indices) {
+              return slice_index(dtype, shape, indices);
+          }, doc_slice_index, "dtype"_a, "shape"_a, "indices"_a);
 }
@@ -15,9 +15,24 @@
 
 extern void export_slice(nb::module_&);
 
+/**
+ * Compute the shape and flat index array of the tensor slice ``indices``.
+ * By default, the index references a contiguous (C-style) tensor with shape
+ * ``shape``. When ``strides`` is specified, it instead references the
+ * storage of a strided view with the given per-axis strides and offset.
+ */
 extern std::pair<nb::tuple, nb::object>
 slice_index(const nb::type_object_t<ArrayBase> &dtype,
-            const nb::tuple &shape, const nb::tuple &indices);
+            const nb::tuple &shape, const nb::tuple &indices,
+            const int64_t *strides = nullptr, size_t offset = 0);
+
+/// Return the strides and offset of a (possibly strided) tensor
+extern std::pair<dr::vector<int64_t>, size_t> tensor_layout(nb::handle h);
+
+/// Create a strided view that references the storage of the tensor 'h'
+extern nb::object tensor_view(nb::handle h, const dr::vector<size_t> &shape,
+                              const dr::vector<int64_t> &strides,
+                              size_t offset);
 
 extern PyObject *mp_subscript(PyObject *, PyObject *) noexcept;
 extern int mp_ass_subscript(PyObject *, PyObject *, PyObject *) noexcept;
@@ -14,17 +14,21 @@ void bind_texture(nb::module_ &m, const char *name) {
     auto tex = nb::class_<Tex>(m, name)
         .def("__init__", [](Tex* t, const dr::vector<size_t>& shape,
                          size_t channels, bool use_accel,
-                         dr::FilterMode filter_mode, dr::WrapMode wrap_mode) {
-                 new (t) Tex(shape.data(), channels, use_accel, filter_mode, wrap_mode); },
+                         dr::FilterMode filter_mode, dr::WrapMode wrap_mode,
+                         dr::TextureLayout layout) {
+                 new (t) Tex(shape.data(), channels, use_accel, filter_mode,
+                             wrap_mode, layout); },
              "shape"_a, "channels"_a, "use_accel"_a = true,
              "filter_mode"_a = dr::FilterMode::Linear,
              "wrap_mode"_a = dr::WrapMode::Clamp,
+             "layout"_a = dr::TextureLayout::RowMajor,
              doc_Texture_init)
         .def(nb::init<const typename Tex::TensorXf &, bool, bool, dr::FilterMode,
-                      dr::WrapMode>(),
+                      dr::WrapMode, dr::TextureLayout>(),
              "tensor"_a, "use_accel"_a = true, "migrate"_a = true,
              "filter_mode"_a = dr::FilterMode::Linear,
              "wrap_mode"_a = dr::WrapMode::Clamp,
+             "layout"_a = dr::TextureLayout::RowMajor,
              doc_Texture_init_tensor)
         .def("set_value", &Tex::template set_value<const typename Tex::Storage &>, "value"_a, "migrate"_a = false, doc_Texture_set_value)
         .def("set_tensor", &Tex::template set_tensor<const typename Tex::TensorXf &>, "tensor"_a,  "migrate"_a = false, doc_Texture_set_tensor)
@@ -35,6 +39,7 @@ void bind_texture(nb::module_ &m, const char *name) {
              nb::rv_policy::reference_internal, doc_Texture_tensor)
         .def("filter_mode", &Tex::filter_mode, doc_Texture_filter_mode)
         .def("wrap_mode", &Tex::wrap_mode, doc_Texture_wrap_mode)
+        .def("layout", &Tex::layout, doc_Texture_layout)
         .def("use_accel", &Tex::use_accel, doc_Texture_use_accel)
         .def("migrated", &Tex::migrated, doc_Texture_migrated)
         .def_prop_ro("shape", [](const Tex &t) {
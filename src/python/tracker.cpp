@@ -19,6 +19,8 @@
 #include "shape.h"
 #include "coop_vec.h"
 #include <string_view>
+#include <memory>
+#include <vector>
 #include <drjit/autodiff.h>
 #include <tsl/robin_map.h>
 
@@ -26,12 +28,33 @@
 
 using index64_vector = dr::detail::index64_vector;
 
+/// Specifies how a ``Variable`` is named relative to its parent
+enum class LabelKind : uint8_t {
+    /// Top-level state variable (e.g. ``"state"``, or a user-provided label)
+    Root,
+
+    /// Element of a sequence or nested array (``"[i]"``)
+    Item,
+
+    /// Dictionary entry (``"[repr(key)]"``)
+    DictKey,
+
+    /// Field of a ``DRJIT_STRUCT`` or dataclass (``".key"``)
+    Field,
+
+    /// Flat storage of a tensor (``".array"``)
+    TensorArray
+};
+
 /**
  * This struct represents the state of Python object encountered during PyTree
  * traversal. It could store a Dr.Jit array, a Python list/dict, etc.
  *
- * The VariableMap data structure declared later maps state variable names
- * to ``Variable`` instances.
+ * Variables form a tree that mirrors the PyTree. Children are stored in
+ * traversal order, which means that subsequent traversals of a PyTree with
+ * the same layout find them without any lookups by name. Labels that
+ * identify variables in error messages are only assembled when needed (see
+ * ``label_of()``).
  */
 struct Variable {
     /// The Python object encountered during the first PyTree traversal
@@ -43,6 +66,11 @@ struct Variable {
     /// The initial and last observed shape (in case this variable refers to a tensor)
     dr::vector<size_t> shape_orig, shape;
 
+    /// For tensors: a copy of the tensor encountered during the first PyTree
+    /// traversal. This preserves the layout of strided views, whose storage
+    /// isn't directly tracked.
+    nb::object tensor_orig;
+
     /// For Dr.Jit arrays: the array ID encountered during the first PyTree traversal
     uint64_t index_orig;
 
@@ -55,53 +83,89 @@ struct Variable {
     /// Set to true when an in-place mutation was detected
     bool mutated;
 
+    /// How is this variable named relative to its parent?
+    LabelKind kind;
+
+    /// Position within the parent (for ``LabelKind::Item``)
+    size_t position;
+
+    /// Dictionary key or field name (for ``LabelKind::DictKey/Field``)
+    nb::object key;
+
+    /// Label of top-level variables (for ``LabelKind::Root``)
+    dr::string name;
+
+    /// Parent variable, or ``nullptr`` for top-level variables
+    Variable *parent;
+
+    /// Nested variables in traversal order
+    std::vector<std::unique_ptr<Variable>> children;
+
     ~Variable() {
         ad_var_dec_ref(index_orig);
         ad_var_dec_ref(index);
     }
 
     /// Initialize from an existing object. The array indices must be set separately
-    Variable(nb::handle value)
+    Variable(nb::handle value, Variable *parent, LabelKind kind,
+             size_t position, nb::handle key)
         : value_orig(nb::borrow(value)), value(nb::borrow(value)), index_orig(0),
-          index(0), size(0), mutated(false) { }
-
-    /// Move constructor
-    Variable(Variable &&v) noexcept
-        : value_orig(std::move(v.value_orig)), value(std::move(v.value)),
-          shape_orig(std::move(v.shape_orig)), shape(std::move(v.shape)),
-          index_orig(v.index_orig), index(v.index), size(v.size),
-          mutated(v.mutated) {
-        v.index_orig = 0;
-        v.index = 0;
-        v.size = 0;
-        v.mutated = 0;
-    }
+          index(0), size(0), mutated(false), kind(kind), position(position),
+          key(nb::borrow(key)), parent(parent) { }
 
-    /// Move assignment
-    Variable &operator=(Variable &&v) noexcept {
-        value_orig = std::move(v.value_orig);
-        value = std::move(v.value);
-        shape = std::move(v.shape);
-        shape_orig = std::move(v.shape_orig);
-        uint64_t old0 = index_orig, old1 = index;
-        index_orig = v.index_orig;
-        index = v.index;
-        v.index = 0;
-        v.index_orig = 0;
-        ad_var_dec_ref(old0);
-        ad_var_dec_ref(old1);
-        size = v.size;
-        mutated = v.mutated;
-        v.size = 0;
-        v.mutated = 0;
-        return *this;
-    }
-
-    // Variables can be move-constructed/assigned, but that's it.
+    // Variables are referenced by pointer and can't be copied or moved
     Variable(const Variable &v) = delete;
     Variable &operator=(const Variable &) = delete;
 };
 
+/// Assemble the label of a variable (e.g., ``"state[0].field"``)
+static dr::string label_of(const Variable *v) {
+    dr::vector<const Variable *> path;
+    for (; v; v = v->parent)
+        path.push_back(v);
+
+    dr::string label;
+    for (size_t i = path.size(); i-- > 0; ) {
+        const Variable *p = path[i];
+        switch (p->kind) {
+            case LabelKind::Root:
+                label.put(p->name.c_str());
+                break;
+
+            case LabelKind::Item:
+                label.put("[", p->position, "]");
+                break;
+
+            case LabelKind::DictKey:
+                label.put("[", nb::repr(p->key).c_str(), "]");
+                break;
+
+            case LabelKind::Field:
+                label.put(".", nb::str(p->key).c_str());
+                break;
+
+            case LabelKind::TensorArray:
+                label.put(".array");
+                break;
+        }
+    }
+
+    return label;
+}
+
+/// Do two dictionary keys or field names match?
+static bool same_key(nb::handle k1, nb::handle k2) {
+    if (k1.is(k2))
+        return true;
+    if (!k1.is_valid() || !k2.is_valid())
+        return false;
+    try {
+        return k1.equal(k2);
+    } catch (...) {
+        return false;
+    }
+}
+
 /// Hash function for ``dr::string`` based on the builtin STL string hasher
 struct StringHash {
     size_t operator()(const dr::string &s) const {
@@ -109,11 +173,12 @@ struct StringHash {
     }
 };
 
-/// Associative data structure mapping from names strings to ``Variable`` instances
+/// Associative data structure mapping from top-level labels to ``Variable`` instances
 using VariableMap =
-    tsl::robin_map<dr::string, Variable, StringHash,
+    tsl::robin_map<dr::string, std::unique_ptr<Variable>, StringHash,
                    std::equal_to<dr::string>,
-                   std::allocator<std::pair<dr::string, Variable>>, true>;
+                   std::allocator<std::pair<dr::string, std::unique_ptr<Variable>>>,
+                   true>;
 
 // Implementation details of VariableTracker. Implemented via PIMPL
 // so that callers don't inherit the STL header file dependencies required
@@ -122,9 +187,12 @@ struct VariableTracker::Impl {
     Impl(bool strict, bool check_size)
         : strict(strict), check_size(check_size) { }
 
-    /// Pointer to a hash table storing the variable state
+    /// Hash table storing the top-level variables
     VariableMap state;
 
+    /// All variables in order of creation
+    dr::vector<Variable *> variables;
+
     /// Enable extra-strict consistency checks?
     bool strict;
 
@@ -132,7 +200,7 @@ struct VariableTracker::Impl {
     bool check_size;
 
     /// Per-tensor shape storage
-    tsl::robin_map<dr::string, dr::vector<size_t>, StringHash> shapes;
+    tsl::robin_map<const Variable *, dr::vector<size_t>> shapes;
 
     /// Implementation detail of ``read()`` and ``write()``
     void traverse(Context &ctx, nb::handle state,
@@ -147,13 +215,74 @@ struct VariableTracker::Impl {
      *
      * The function returns 'true' when changes in the subtree were detected.
      */
-    bool traverse(Context &ctx, nb::handle h);
+    bool traverse(Context &ctx, nb::handle h, Variable *v, bool new_variable);
+
+    /// Look up or create the child of ``parent`` and traverse it
+    bool traverse_child(Context &ctx, Variable *parent, LabelKind kind,
+                        size_t position, nb::handle key, nb::handle h) {
+        bool new_variable = false;
+        Variable *v = lookup(parent, position, key);
+        if (!v) {
+            v = new Variable(h, parent, kind, position, key);
+            parent->children.emplace_back(v);
+            variables.push_back(v);
+            new_variable = true;
+        }
+        return traverse(ctx, h, v, new_variable);
+    }
+
+    /// Look up or create a top-level variable
+    Variable *root(const char *label, nb::handle h, bool &new_variable) {
+        dr::string name;
+        name = label;
+
+        auto it = state.find(name);
+        new_variable = it == state.end();
+        if (!new_variable)
+            return it->second.get();
+
+        Variable *v = new Variable(h, nullptr, LabelKind::Root, 0, nb::handle());
+        v->name = name;
+        state.emplace(name, std::unique_ptr<Variable>(v));
+        variables.push_back(v);
+        return v;
+    }
+
+    /// Find the child of ``parent`` at ``position`` (or with key ``key``)
+    Variable *lookup(Variable *parent, size_t position, nb::handle key) {
+        std::vector<std::unique_ptr<Variable>> &c = parent->children;
+
+        // Fast path: the layout of the PyTree didn't change
+        if (position < c.size() && same_key(c[position]->key, key))
+            return c[position].get();
+
+        // Dictionaries with a different key order
+        if (key.is_valid()) {
+            for (std::unique_ptr<Variable> &v : c) {
+                if (same_key(v->key, key))
+                    return v.get();
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// Like ``lookup()``, but raise an exception when the child doesn't exist
+    Variable *find(Variable *parent, size_t position, nb::handle key,
+                   const char *func) {
+        Variable *v = lookup(parent, position, key);
+        if (!v)
+            nb::raise("VariableTracker::%s(): could not find entry %zu of "
+                      "variable named \"%s\"", func, position,
+                      label_of(parent).c_str());
+        return v;
+    }
 
     /// Undo all changes and restore tracked variables to their original state
-    nb::object restore(dr::string &label);
+    nb::object restore(Variable *v);
 
     /// Rebuild the final state of a PyTree following an operation
-    std::pair<nb::object, bool> rebuild(dr::string &label);
+    std::pair<nb::object, bool> rebuild(Variable *v);
 };
 
 
@@ -177,8 +306,8 @@ struct VariableTracker::Context {
     /// Enable strict size checks?
     bool check_size;
 
-    /// Label of the variable currently being traversed
-    dr::string label;
+    /// Variable whose custom traversal callback is currently running
+    const Variable *var;
 
     /// A stack to avoid infinite recursion
     dr::vector<nb::handle> stack;
@@ -189,7 +318,7 @@ struct VariableTracker::Context {
     Context(dr::vector<uint64_t> &indices, bool write, bool preserve_dirty,
             bool check_size)
         : indices(indices), write(write), preserve_dirty(preserve_dirty),
-          check_size(check_size), index_offset(0) { }
+          check_size(check_size), var(nullptr), index_offset(0) { }
 
     // Internal API for type-erased traversal
     uint64_t _traverse_write(uint64_t idx, const char *, const char *);
@@ -198,11 +327,12 @@ struct VariableTracker::Context {
 
 // Temporarily push a value onto the stack
 struct StackGuard {
-    StackGuard(VariableTracker::Context &ctx, nb::handle h) : stack(ctx.stack) {
+    StackGuard(VariableTracker::Context &ctx, nb::handle h, const Variable *v)
+        : stack(ctx.stack) {
         for (nb::handle h2 : stack) {
             if (h.is(h2))
                 nb::raise("detected a cycle in field %s. This is not permitted.",
-                          ctx.label.c_str());
+                          label_of(v).c_str());
         }
 
         stack.push_back(h);
@@ -213,24 +343,6 @@ struct StackGuard {
     dr::vector<nb::handle> &stack;
 };
 
-// Temporarily append a suffix to the variable label
-struct ScopedAppendLabel {
-    template <typename...Ts> ScopedAppendLabel(dr::string &s, Ts&&... args) : s(s) {
-        length = s.length();
-        s.put(std::forward<Ts>(args)...);
-    }
-
-    template <typename...Ts> ScopedAppendLabel(VariableTracker::Context &ctx, Ts&&... args) : s(ctx.label) {
-        length = s.length();
-        s.put(std::forward<Ts>(args)...);
-    }
-
-    ~ScopedAppendLabel() { s.resize(length); }
-
-    dr::string &s;
-    size_t length;
-};
-
 VariableTracker::VariableTracker(bool strict, bool check_size)
     : m_impl(new Impl(strict, check_size)) {
 }
@@ -271,9 +383,11 @@ void VariableTracker::write(nb::handle state,
 void VariableTracker::Impl::traverse(Context &ctx, nb::handle state_,
                                      const dr::vector<dr::string> &labels,
                                      const char *default_label) {
+    bool new_variable = false;
+
     if (labels.empty()) {
-        ctx.label = default_label;
-        traverse(ctx, state_);
+        Variable *v = root(default_label, state_, new_variable);
+        traverse(ctx, state_, v, new_variable);
     } else {
         if (!state_.type().is(&PyTuple_Type))
             nb::raise("VariableTracker::traverse(): must specify state "
@@ -285,8 +399,9 @@ void VariableTracker::Impl::traverse(Context &ctx, nb::handle state_,
                       state_len, labels.size());
 
         for (size_t i = 0; i < state_len; ++i) {
-            ctx.label = labels[i];
-            traverse(ctx, state_[i]);
+            nb::handle h = NB_TUPLE_GET_ITEM(state_.ptr(), i);
+            Variable *v = root(labels[i].c_str(), h, new_variable);
+            traverse(ctx, h, v, new_variable);
         }
     }
 
@@ -295,14 +410,14 @@ void VariableTracker::Impl::traverse(Context &ctx, nb::handle state_,
                   ctx.index_offset, ctx.indices.size());
 }
 
-static size_t size_valid(Variable *v, const dr::string &label, nb::handle h, size_t size) {
+static size_t size_valid(Variable *v, nb::handle h, size_t size) {
     if (v->size == 0)
         v->size = size;
     else if (v->size != size)
         nb::raise(
             "the size of state variable '%s' of type '%s' changed "
             "from %zu to %zu.",
-            label.c_str(), nb::inst_name(h).c_str(), v->size, size);
+            label_of(v).c_str(), nb::inst_name(h).c_str(), v->size, size);
     return size;
 }
 
@@ -312,16 +427,11 @@ static size_t size_valid(Variable *v, const dr::string &label, nb::handle h, siz
  * inconsistencies with a useful error message that identifies variables by
  * name.
  */
-bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
-    StackGuard stack_guard(ctx, h);
+bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h, Variable *v,
+                                     bool new_variable) {
+    StackGuard stack_guard(ctx, h, v);
     nb::handle tp = h.type();
 
-    // Have we already encountered this variable before?
-    bool new_variable = false;
-    VariableMap::iterator it;
-    std::tie(it, new_variable) = state.try_emplace(ctx.label, h);
-    Variable *v = &it.value();
-
     // Update the Python object
     nb::object prev = v->value;
     v->value = nb::borrow(h);
@@ -330,7 +440,7 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
     if (!prev.type().is(tp))
         nb::raise("the type of state variable '%s' changed from '%s' to '%s', "
                   "which is not permitted",
-                  ctx.label.c_str(), nb::inst_name(prev).c_str(),
+                  label_of(v).c_str(), nb::inst_name(prev).c_str(),
                   nb::type_name(tp).c_str());
 
     // Were there any external changes to sub-PyTree variable indices (as
@@ -344,6 +454,15 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             return false;
 
         if (s.is_tensor) {
+            if (new_variable) {
+                v->tensor_orig = nb::inst_alloc(tp);
+                nb::inst_copy(v->tensor_orig, h);
+            }
+
+            // Views are only converted into contiguous tensors when written
+            if (ctx.write)
+                s.tensor_materialize(inst_ptr(h));
+
             dr::vector<size_t> &shape = s.tensor_shape(inst_ptr(h));
             size_t size = 1;
             for (size_t sv: shape)
@@ -355,21 +474,20 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             }
             v->shape = shape;
 
-            dr::string tensor_label = ctx.label;
             // Keep track of the tensor's shape
             if (!ctx.write && !shape.empty())
-                shapes[tensor_label] = shape;
+                shapes[v] = shape;
 
-            ScopedAppendLabel guard(ctx, ".array");
             nb::object array = nb::steal(s.tensor_array(h.ptr()));
-            changed = traverse(ctx, array);
+            changed = traverse_child(ctx, v, LabelKind::TensorArray, 0,
+                                     nb::handle(), array);
 
             // If we're writing a tensor and the current array size is
             // incompatible with the tensor's shape, it must be updated
             size_t array_len = (size_t) nb::len(array);
             if (ctx.write && size != array_len) {
                 // Check the 'shapes' map to see if a shape was stored there
-                auto shape_it = shapes.find(tensor_label);
+                auto shape_it = shapes.find(v);
                 if (shape_it != shapes.end()) {
                     size_t recorded_size = 1;
                     for (size_t sv : shape_it->second)
@@ -409,11 +527,12 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             size_t size = s.shape[0];
             if (size == DRJIT_DYNAMIC)
                 size = s.len(inst_ptr(h));
-            size_valid(v, ctx.label, h, size);
+            size_valid(v, h, size);
 
             for (size_t i = 0; i < size; ++i) {
-                ScopedAppendLabel guard(ctx, "[", i, "]");
-                changed |= traverse(ctx, nb::steal(s.item(h.ptr(), (Py_ssize_t) i)));
+                nb::object item = nb::steal(s.item(h.ptr(), (Py_ssize_t) i));
+                changed |= traverse_child(ctx, v, LabelKind::Item, i,
+                                          nb::handle(), item);
             }
         } else if (s.index) {
             uint64_t idx = s.index(inst_ptr(h));
@@ -426,7 +545,7 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
 
                 if (ctx.index_offset >= ctx.indices.size())
                     nb::raise("internal error at state variable '%s': ran "
-                              "out of indices", ctx.label.c_str());
+                              "out of indices", label_of(v).c_str());
 
                 idx = ctx.indices[ctx.index_offset];
                 s.reset_index(idx, inst_ptr(h));
@@ -435,14 +554,14 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             #if defined(DEBUG_TRACKER)
                 printf("%s '%s' (%p) a%u r%u (size=%zu)\n",
                        ctx.write ? "write " : "read ",
-                       ctx.label.c_str(), h.ptr(), uint32_t(idx >> 32),
+                       label_of(v).c_str(), h.ptr(), uint32_t(idx >> 32),
                        (uint32_t) idx,
                        jit_var_size((uint32_t) idx));
             #endif
 
             if (!idx)
                 nb::raise("state variable '%s' of type '%s' is uninitialized",
-                          ctx.label.c_str(), nb::inst_name(h).c_str());
+                          label_of(v).c_str(), nb::inst_name(h).c_str());
 
             VarInfo vi = jit_set_backend((uint32_t) idx);
 
@@ -456,7 +575,7 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                         "the size of state variable '%s' of type '%s' changed "
                         "from %zu to %zu. These sizes aren't compatible, and "
                         "such a change is therefore not permitted",
-                        ctx.label.c_str(), nb::inst_name(h).c_str(), v->size,
+                        label_of(v).c_str(), nb::inst_name(h).c_str(), v->size,
                         vi.size);
 
                 changed = idx != v->index;
@@ -482,7 +601,7 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             } else {
                 if (ctx.index_offset >= ctx.indices.size())
                     nb::raise("internal error at state variable '%s': ran "
-                              "out of indices", ctx.label.c_str());
+                              "out of indices", label_of(v).c_str());
 
                 uint64_t idx_new = ctx.indices[ctx.index_offset++];
                 VarInfo vi_new = jit_set_backend((uint32_t) idx_new);
@@ -493,14 +612,14 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                               "size of state variable '%s' of type "
                               "'%s' from %zu to %zu. Aborting because "
                               "these sizes aren't compatible",
-                              ctx.label.c_str(), nb::inst_name(h).c_str(),
+                              label_of(v).c_str(), nb::inst_name(h).c_str(),
                               vi.size, vi_new.size);
 
                 if (vi.type != vi_new.type)
                     nb::raise("internal error: the JIT variable type of "
                               "state variable '%s' (of type '%s') changed "
                               "from '%s' to '%s'",
-                              ctx.label.c_str(), nb::inst_name(h).c_str(),
+                              label_of(v).c_str(), nb::inst_name(h).c_str(),
                               jit_type_name(vi.type), jit_type_name(vi_new.type));
 
                 if (idx != idx_new &&
@@ -524,21 +643,21 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                 ctx.indices.push_back(ad_var_inc_ref(idx));
                 ctx.index_offset++;
                 #if defined(DEBUG_TRACKER)
-                    printf("read '%s' (array): r%u\n", ctx.label.c_str(), (uint32_t) idx);
+                    printf("read '%s' (array): r%u\n", label_of(v).c_str(), (uint32_t) idx);
                 #endif
             }
         } else {
             for (uint32_t &idx: arrays) {
                 if (ctx.index_offset >= ctx.indices.size())
                     nb::raise("internal error at state variable '%s': ran "
-                              "out of indices", ctx.label.c_str());
+                              "out of indices", label_of(v).c_str());
 
                 uint64_t idx_new = ctx.indices[ctx.index_offset++];
                 if (!ctx.preserve_dirty) {
                     jit_var_dec_ref(idx);
                     jit_var_inc_ref((uint32_t)idx_new);
                     #if defined(DEBUG_TRACKER)
-                        printf("write '%s' (array): r%u\n", ctx.label.c_str(), (uint32_t) idx_new);
+                        printf("write '%s' (array): r%u\n", label_of(v).c_str(), (uint32_t) idx_new);
                     #endif
                     idx = (uint32_t)idx_new;
                 }
@@ -546,29 +665,26 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
         }
     } else if (tp.is(&PyTuple_Type)) {
         nb::tuple t = nb::borrow<nb::tuple>(h);
-        size_t size = size_valid(v, ctx.label, h, nb::len(t));
-        for (size_t i = 0; i < size; ++i) {
-            ScopedAppendLabel guard(ctx, "[", i, "]");
-            changed |= traverse(ctx, t[i]);
-        }
+        size_t size = size_valid(v, h, nb::len(t));
+        for (size_t i = 0; i < size; ++i)
+            changed |= traverse_child(ctx, v, LabelKind::Item, i,
+                                      nb::handle(), t[i]);
     } else if (tp.is(&PyList_Type)) {
         nb::list l = nb::borrow<nb::list>(h);
-        size_t size = size_valid(v, ctx.label, h, nb::len(l));
-        for (size_t i = 0; i < size; ++i) {
-            ScopedAppendLabel guard(ctx, "[", i, "]");
-            changed |= traverse(ctx, l[i]);
-        }
+        size_t size = size_valid(v, h, nb::len(l));
+        for (size_t i = 0; i < size; ++i)
+            changed |= traverse_child(ctx, v, LabelKind::Item, i,
+                                      nb::handle(), l[i]);
     } else if (tp.is(&PyDict_Type)) {
         nb::dict d = nb::borrow<nb::dict>(h);
-        size_valid(v, ctx.label, h, nb::len(d));
-        for (nb::handle kv: d.items()) {
-            ScopedAppendLabel guard(ctx, "[", nb::repr(kv[0]).c_str(), "]");
-            changed |= traverse(ctx, kv[1]);
-        }
+        size_valid(v, h, nb::len(d));
+        size_t i = 0;
+        for (auto [k, value] : d)
+            changed |= traverse_child(ctx, v, LabelKind::DictKey, i++, k, value);
     } else if (tp.is(coop_vector_type)) {
         CoopVec *vec = nb::cast<CoopVec *>(h, false);
         uint32_t idx = (uint32_t) vec->m_index;
-        size_t size = size_valid(v, ctx.label, h, vec->m_size);
+        size_t size = size_valid(v, h, vec->m_size);
 
         if (new_variable) {
             v->index_orig = ad_var_inc_ref(idx);
@@ -584,15 +700,16 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
 
         if (!ctx.write && !changed && !new_variable) {
             for (size_t i = 0; i < size; ++i) {
-                ScopedAppendLabel guard(ctx, "[", i, "]");
-                changed |= traverse(ctx, state.find(ctx.label)->second.value);
+                nb::object value =
+                    find(v, i, nb::handle(), "traverse")->value;
+                changed |= traverse_child(ctx, v, LabelKind::Item, i,
+                                          nb::handle(), value);
             }
         } else {
             nb::list l(h), r;
-            for (size_t i = 0; i < size; ++i) {
-                ScopedAppendLabel guard(ctx, "[", i, "]");
-                changed |= traverse(ctx, l[i]);
-            }
+            for (size_t i = 0; i < size; ++i)
+                changed |= traverse_child(ctx, v, LabelKind::Item, i,
+                                          nb::handle(), l[i]);
             if (ctx.write) {
                 *vec = CoopVec(l);
                 ad_var_inc_ref(vec->m_index);
@@ -606,20 +723,21 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
             nb::handle());
 
         if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
-            for (auto [k, _] : ds) {
-                ScopedAppendLabel guard(ctx, ".", nb::str(k).c_str());
-                changed |= traverse(ctx, nb::getattr(h, k));
-            }
+            size_t i = 0;
+            for (auto [k, _] : ds)
+                changed |= traverse_child(ctx, v, LabelKind::Field, i++, k,
+                                          nb::getattr(h, k));
         } else if (traverse_cb.is_valid()) {
-            ScopedAppendLabel guard(ctx, "._traverse_cb()");
+            ctx.var = v;
             traverse_cb(
                 nb::cast(ctx, nb::rv_policy::reference)
                     .attr(ctx.write ? DR_STR(_traverse_write) : DR_STR(_traverse_read)));
         } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
+            size_t i = 0;
             for (nb::handle field : df) {
                 nb::object k = field.attr(DR_STR(name));
-                ScopedAppendLabel guard(ctx, ".", nb::str(k).c_str());
-                changed |= traverse(ctx, nb::getattr(h, k));
+                changed |= traverse_child(ctx, v, LabelKind::Field, i++, k,
+                                          nb::getattr(h, k));
             }
         } else if (strict && !new_variable && !h.is(prev)) {
             bool is_same = false;
@@ -635,20 +753,15 @@ bool VariableTracker::Impl::traverse(Context &ctx, nb::handle h) {
                     "the non-array state variable '%s' of type '%s' changed "
                     "from '%s' to '%s'. You can annotate the loop/conditional "
                     "with ``strict=False`` to disable this check.",
-                    ctx.label.c_str(), nb::type_name(tp).c_str(), s0.c_str(),
+                    label_of(v).c_str(), nb::type_name(tp).c_str(), s0.c_str(),
                     s1.c_str());
             }
         }
     }
 
     // Detect changes performed via in-place mutation
-    if (!ctx.write && changed && h.is(prev)) {
-        it = state.find(ctx.label);
-        if (it == state.end())
-            nb::raise("VariableTracker::traverse(): internal error -- cannot "
-                      "find mutated variable anymore.");
-        it.value().mutated = true;
-    }
+    if (!ctx.write && changed && h.is(prev))
+        v->mutated = true;
 
     return changed;
 }
@@ -659,14 +772,14 @@ uint64_t VariableTracker::Context::_traverse_write(uint64_t idx, const char *,
         return 0;
     if (index_offset >= indices.size())
         nb::raise("internal error after state variable '%s': ran "
-                  "out of indices", label.c_str());
+                  "out of indices", label_of(var).c_str());
 
     uint64_t idx_new = indices[index_offset++];
 
     if (!idx_new)
         nb::raise("internal error after state variable "
                   "'%s': uninitialized variable",
-                  label.c_str());
+                  label_of(var).c_str());
 
     VarInfo vi = jit_set_backend((uint32_t)idx),
             vi_new = jit_set_backend((uint32_t)idx_new);
@@ -678,14 +791,14 @@ uint64_t VariableTracker::Context::_traverse_write(uint64_t idx, const char *,
             "inside '%s' changed from %zu to %zu. "
             "These sizes aren't compatible, and such a "
             "change is therefore not permitted",
-            label.c_str(), vi.size, vi_new.size);
+            label_of(var).c_str(), vi.size, vi_new.size);
 
     if (vi.type != vi_new.type)
         nb::raise(
             "the type of an unnamed state variable "
             "inside '%s' changed from '%s' to '%s', "
             "which is not permitted",
-            label.c_str(), jit_type_name(vi.type),
+            label_of(var).c_str(), jit_type_name(vi.type),
             jit_type_name(vi_new.type));
 
     return idx_new;
@@ -700,40 +813,47 @@ void VariableTracker::Context::_traverse_read(uint64_t index, const char *, cons
 
 void VariableTracker::clear() {
     m_impl->state.clear();
+    m_impl->variables.clear();
+    m_impl->shapes.clear();
 }
 
 void VariableTracker::verify_size(size_t size) {
-    for (auto &kv : m_impl->state) {
-        const Variable &v = kv.second;
-
+    for (const Variable *v : m_impl->variables) {
         // Check if the variable was unchanged by the loop
-        if ((uint32_t) v.index == (uint32_t) v.index_orig ||
-            strcmp(jit_var_kind_name((uint32_t) v.index), "loop_phi") == 0)
+        if ((uint32_t) v->index == (uint32_t) v->index_orig ||
+            strcmp(jit_var_kind_name((uint32_t) v->index), "loop_phi") == 0)
             continue;
 
-        size_t size_2 = jit_var_size((uint32_t) v.index);
+        size_t size_2 = jit_var_size((uint32_t) v->index);
 
-        if (size != size_2 && size != 1 && size_2 != 1 && !jit_var_is_dirty((uint32_t)v.index))
+        if (size != size_2 && size != 1 && size_2 != 1 && !jit_var_is_dirty((uint32_t)v->index))
             nb::raise("this operation processes arrays of size %zu, while "
                       "state variable '%s' has an incompatible size %zu. [(a%u, r%u) -> (a%u, r%u)]",
-                      size, kv.first.c_str(), size_2,
-                      uint32_t(v.index_orig >> 32), uint32_t(v.index_orig),
-                      uint32_t(v.index >> 32), uint32_t(v.index));
+                      size, label_of(v).c_str(), size_2,
+                      uint32_t(v->index_orig >> 32), uint32_t(v->index_orig),
+                      uint32_t(v->index >> 32), uint32_t(v->index));
     }
 }
 
 nb::object VariableTracker::restore(const dr::vector<dr::string> &labels,
                                     const char *default_label) {
+    auto find_root = [&](const char *label) {
+        dr::string name;
+        name = label;
+        auto it = m_impl->state.find(name);
+        if (it == m_impl->state.end())
+            nb::raise("VariableTracker::restore(): could not find variable "
+                      "named \"%s\"", label);
+        return it->second.get();
+    };
 
-    dr::string label;
     if (labels.empty()) {
-        label = default_label;
-        return m_impl->restore(label);
+        return m_impl->restore(find_root(default_label));
     } else {
         nb::object result = nb::steal(PyTuple_New(labels.size()));
         for (size_t i = 0; i < labels.size(); ++i) {
-            label = labels[i];
-            NB_TUPLE_SET_ITEM(result.ptr(), i, m_impl->restore(label).release().ptr());
+            Variable *v = find_root(labels[i].c_str());
+            NB_TUPLE_SET_ITEM(result.ptr(), i, m_impl->restore(v).release().ptr());
         }
         return result;
     }
@@ -741,28 +861,29 @@ nb::object VariableTracker::restore(const dr::vector<dr::string> &labels,
 
 nb::object VariableTracker::rebuild(const dr::vector<dr::string> &labels,
                                     const char *default_label) {
+    auto find_root = [&](const char *label) {
+        dr::string name;
+        name = label;
+        auto it = m_impl->state.find(name);
+        if (it == m_impl->state.end())
+            nb::raise("VariableTracker::rebuild(): could not find variable "
+                      "named \"%s\"", label);
+        return it->second.get();
+    };
 
-    dr::string label;
     if (labels.empty()) {
-        label = default_label;
-        return m_impl->rebuild(label).first;
+        return m_impl->rebuild(find_root(default_label)).first;
     } else {
         nb::object result = nb::steal(PyTuple_New(labels.size()));
         for (size_t i = 0; i < labels.size(); ++i) {
-            label = labels[i];
-            NB_TUPLE_SET_ITEM(result.ptr(), i, m_impl->rebuild(label).first.release().ptr());
+            Variable *v = find_root(labels[i].c_str());
+            NB_TUPLE_SET_ITEM(result.ptr(), i, m_impl->rebuild(v).first.release().ptr());
         }
         return result;
     }
 }
 
-nb::object VariableTracker::Impl::restore(dr::string &label) {
-    VariableMap::iterator it = state.find(label);
-    if (it == state.end())
-        nb::raise("VariableTracker::restore(): could not find variable "
-                  "named \"%s\"", label.c_str());
-
-    Variable *v = &it.value();
+nb::object VariableTracker::Impl::restore(Variable *v) {
     nb::object value = v->value_orig;
     nb::handle tp = value.type();
 
@@ -773,39 +894,32 @@ nb::object VariableTracker::Impl::restore(dr::string &label) {
             return value;
 
         if (s.is_tensor) {
-            ScopedAppendLabel guard(label, ".array");
-            (void) restore(label);
-            s.tensor_shape(inst_ptr(value)) = v->shape_orig;
+            (void) restore(find(v, 0, nb::handle(), "restore"));
+            nb::inst_replace_copy(value, v->tensor_orig);
         } else if (s.ndim > 1) {
-            size_t size = size_valid(v, label, value, nb::len(value));
+            size_t size = size_valid(v, value, nb::len(value));
             for (size_t i = 0; i < size; ++i) {
-                ScopedAppendLabel guard(label, "[", i, "]");
                 nb::inst_replace_copy(
                     nb::steal(s.item(value.ptr(), (Py_ssize_t) i)),
-                    restore(label));
+                    restore(find(v, i, nb::handle(), "restore")));
             }
         } else if (s.index) {
             s.reset_index(v->index_orig, inst_ptr(value));
         }
     } else if (tp.is(&PyTuple_Type)) {
-        size_valid(v, label, value, nb::len(value));
-        for (size_t i = 0; i < v->size; ++i) {
-            ScopedAppendLabel guard(label, "[", i, "]");
-            (void) restore(label);
-        }
+        size_valid(v, value, nb::len(value));
+        for (size_t i = 0; i < v->size; ++i)
+            (void) restore(find(v, i, nb::handle(), "restore"));
     } else if (tp.is(&PyList_Type)) {
         nb::list l = nb::borrow<nb::list>(value);
-        size_t size = size_valid(v, label, value, nb::len(l));
-        for (size_t i = 0; i < size; ++i) {
-            ScopedAppendLabel guard(label, "[", i, "]");
-            l[i] = restore(label);
-        }
+        size_t size = size_valid(v, value, nb::len(l));
+        for (size_t i = 0; i < size; ++i)
+            l[i] = restore(find(v, i, nb::handle(), "restore"));
     } else if (tp.is(&PyDict_Type)) {
         nb::dict d = nb::borrow<nb::dict>(value);
-        for (nb::handle k: d.keys()) {
-            ScopedAppendLabel guard(label, "[", nb::repr(k).c_str(), "]");
-            d[k] = restore(label);
-        }
+        size_t i = 0;
+        for (nb::handle k: d.keys())
+            d[k] = restore(find(v, i++, k, "restore"));
     } else if (tp.is(coop_vector_type)) {
         CoopVec *vec = nb::cast<CoopVec *>(value, false);
         ad_var_inc_ref(v->index_orig);
@@ -813,15 +927,14 @@ nb::object VariableTracker::Impl::restore(dr::string &label) {
         vec->m_index = v->index_orig;
     } else {
         if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
-            for (auto [k, _] : ds) {
-                ScopedAppendLabel guard(label, ".", nb::str(k).c_str());
-                nb::setattr(value, k, restore(label));
-            }
+            size_t i = 0;
+            for (auto [k, _] : ds)
+                nb::setattr(value, k, restore(find(v, i++, k, "restore")));
         } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
+            size_t i = 0;
             for (nb::handle field : df) {
                 nb::object k = field.attr(DR_STR(name));
-                ScopedAppendLabel guard(label, ".", nb::str(k).c_str());
-                nb::setattr(value, k, restore(label));
+                nb::setattr(value, k, restore(find(v, i++, k, "restore")));
             }
         }
     }
@@ -829,13 +942,7 @@ nb::object VariableTracker::Impl::restore(dr::string &label) {
     return value;
 }
 
-std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
-    VariableMap::iterator it = state.find(label);
-    if (it == state.end())
-        nb::raise("VariableTracker::rebuild(): could not find variable "
-                  "named \"%s\"", label.c_str());
-
-    Variable *v = &it.value();
+std::pair<nb::object, bool> VariableTracker::Impl::rebuild(Variable *v) {
     nb::object value = v->value_orig;
     nb::handle tp = value.type();
     bool new_object = false, mutate = v->mutated;
@@ -847,8 +954,7 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
             return { value, false };
 
         if (s.is_tensor) {
-            ScopedAppendLabel guard(label, ".array");
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, 0, nb::handle(), "rebuild"));
             if (n) {
                 if (mutate) {
                     jit_raise(
@@ -859,14 +965,20 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
                     new_object = true;
                 }
             } else {
-                s.tensor_shape(inst_ptr(value)) = v->shape;
+                dr::vector<size_t> &shape = s.tensor_shape(inst_ptr(value));
+                if (shape.size() != v->shape.size() ||
+                    memcmp(shape.data(), v->shape.data(),
+                           shape.size() * sizeof(size_t)) != 0) {
+                    // Writing the shape requires a contiguous tensor
+                    s.tensor_materialize(inst_ptr(value));
+                    s.tensor_shape(inst_ptr(value)) = v->shape;
+                }
             }
         } else if (s.ndim > 1) {
-            size_t size = size_valid(v, label, value, nb::len(value));
+            size_t size = size_valid(v, value, nb::len(value));
             nb::list tmp;
             for (size_t i = 0; i < size; ++i) {
-                ScopedAppendLabel guard(label, "[", i, "]");
-                auto [o, n] = rebuild(label);
+                auto [o, n] = rebuild(find(v, i, nb::handle(), "rebuild"));
                 tmp.append(o);
                 new_object |= n;
             }
@@ -894,11 +1006,10 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
             }
         }
     } else if (tp.is(&PyTuple_Type) || tp.is(&PyList_Type)) {
-        size_t size = size_valid(v, label, value, nb::len(value));
+        size_t size = size_valid(v, value, nb::len(value));
         nb::list tmp;
         for (size_t i = 0; i < size; ++i) {
-            ScopedAppendLabel guard(label, "[", i, "]");
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, i, nb::handle(), "rebuild"));
             tmp.append(o);
             new_object |= n;
         }
@@ -914,9 +1025,9 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
         }
     } else if (tp.is(&PyDict_Type)) {
         nb::dict tmp, value_d = nb::borrow<nb::dict>(value);
+        size_t i = 0;
         for (nb::handle k: value_d.keys()) {
-            ScopedAppendLabel guard(label, "[", nb::repr(k).c_str(), "]");
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, i++, k, "rebuild"));
             tmp[k] = o;
             new_object |= n;
         }
@@ -929,12 +1040,11 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
             }
         }
     } else if (tp.is(coop_vector_type)) {
-        size_t size = size_valid(v, label, value, nb::len(value));
+        size_t size = size_valid(v, value, nb::len(value));
         nb::list tmp;
 
         for (size_t i = 0; i < size; ++i) {
-            ScopedAppendLabel guard(label, "[", i, "]");
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, i, nb::handle(), "rebuild"));
             tmp.append(o);
         }
 
@@ -942,9 +1052,9 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
         new_object = true;
     } else if (nb::dict ds = get_drjit_struct(tp); ds.is_valid()) {
         nb::object tmp = tp();
+        size_t i = 0;
         for (auto [k, _] : ds) {
-            ScopedAppendLabel guard(label, ".", nb::str(k).c_str());
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, i++, k, "rebuild"));
             nb::setattr(tmp, k, o);
             new_object |= n;
         }
@@ -959,10 +1069,10 @@ std::pair<nb::object, bool> VariableTracker::Impl::rebuild(dr::string &label) {
         }
     } else if (nb::object df = get_dataclass_fields(tp); df.is_valid()) {
         nb::dict tmp;
+        size_t i = 0;
         for (auto field : df) {
             nb::object k = field.attr(DR_STR(name));
-            ScopedAppendLabel guard(label, ".", nb::str(k).c_str());
-            auto [o, n] = rebuild(label);
+            auto [o, n] = rebuild(find(v, i++, k, "rebuild"));
             tmp[k] = o;
             new_object |= n;
         }
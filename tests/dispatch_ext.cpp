@@ -0,0 +1,46 @@
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <drjit/dispatch.h>
+#include <string>
+#include <vector>
+
+namespace nb = nanobind;
+namespace dr = drjit;
+
+DRJIT_DISPATCH_DECLARE(variant_name, const char *())
+DRJIT_DISPATCH_DECLARE(packet_size, size_t())
+DRJIT_DISPATCH_DECLARE(saxpy, void(float, const float *, float *, size_t))
+
+NB_MODULE(dispatch_ext, m) {
+    m.def("detected_isa", []() { return dr::cpu_isa_name(dr::cpu_isa_detect()); });
+
+    // Instruction sets, for which a variant was compiled and that are
+    // supported by the CPU
+    m.def("available_isas", []() {
+        std::vector<std::string> result;
+        for (uint32_t i = 0; i <= (uint32_t) dr::cpu_isa_detect(); ++i) {
+            if (saxpy_dispatch().resolve_isa((dr::CpuIsa) i) == (dr::CpuIsa) i)
+                result.push_back(dr::cpu_isa_name((dr::CpuIsa) i));
+        }
+        return result;
+    });
+
+    m.def("set_isa_limit", [](const char *name) {
+        dr::CpuIsa isa = dr::cpu_isa_from_name(name);
+        if (isa == dr::CpuIsa::Count && strcmp(name, "none") != 0)
+            throw std::runtime_error("Unknown instruction set!");
+        dr::set_cpu_isa_limit(isa);
+    });
+
+    m.def("isa", []() { return dr::cpu_isa_name(dr::cpu_isa()); });
+    m.def("variant_name", []() { return std::string(variant_name()); });
+    m.def("packet_size", []() { return packet_size(); });
+
+    m.def("saxpy", [](float a, const std::vector<float> &x, std::vector<float> y) {
+        if (x.size() != y.size())
+            throw std::runtime_error("Size mismatch!");
+        saxpy(a, x.data(), y.data(), x.size());
+        return y;
+    });
+}
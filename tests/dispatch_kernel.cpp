@@ -0,0 +1,30 @@
+/*
+   Kernel used by 'dispatch_ext'. This file is compiled once per instruction
+   set via 'drjit_add_dispatch()' and should not be built on its own.
+*/
+
+#include <drjit/packet.h>
+
+namespace dr = drjit;
+
+namespace DRJIT_DISPATCH_NS {
+
+const char *variant_name() { return DRJIT_TOSTRING(DRJIT_DISPATCH_ISA); }
+
+size_t packet_size() { return dr::Packet<float>::Size; }
+
+void saxpy(float a, const float *x, float *y, size_t n) {
+    using FloatP = dr::Packet<float>;
+
+    size_t i = 0;
+    for (; i + FloatP::Size <= n; i += FloatP::Size) {
+        FloatP xp = dr::load<FloatP>(x + i),
+               yp = dr::load<FloatP>(y + i);
+        dr::store(y + i, dr::fmadd(FloatP(a), xp, yp));
+    }
+
+    for (; i < n; ++i)
+        y[i] = dr::fmadd(a, x[i], y[i]);
+}
+
+} // namespace DRJIT_DISPATCH_NS
@@ -0,0 +1,149 @@
+#define NB_INTRUSIVE_EXPORT NB_IMPORT
+
+#include <nanobind/nanobind.h>
+#include <drjit/dynamic.h>
+#include <vector>
+
+namespace nb = nanobind;
+namespace dr = drjit;
+
+#define check(cond)                                                            \
+    do {                                                                       \
+        if (!(cond))                                                           \
+            nb::raise("%s (size %zu): check \"%s\" failed.", name, size,     \
+                      #cond);                                                  \
+    } while (0)
+
+/// Does the array store its contents in its own inline buffer?
+template <typename Array> bool is_inline(const Array &a) {
+    uintptr_t p = (uintptr_t) a.data(), base = (uintptr_t) &a;
+    return a.data() && p >= base && p < base + sizeof(Array);
+}
+
+template <typename Array> Array make(size_t size, size_t offset = 0) {
+    using Value = dr::value_t<Array>;
+    Array result = Array::empty_(size);
+    for (size_t i = 0; i < size; ++i)
+        result.entry(i) = (Value) (i + offset);
+    return result;
+}
+
+template <typename Array>
+bool has_contents(const Array &a, size_t size, size_t offset = 0) {
+    using Value = dr::value_t<Array>;
+    if (a.size() != size)
+        return false;
+    for (size_t i = 0; i < size; ++i) {
+        if (a.data()[i] != (Value) (i + offset))
+            return false;
+    }
+    return true;
+}
+
+/// Sizes around the transition from inline to heap storage
+template <typename Array> std::vector<size_t> test_sizes() {
+    size_t s = Array::SmallSize;
+    return { 0, 1, 2, s > 1 ? s - 1 : 1, s, s + 1, s + 2, 2 * s + 3, 1000 };
+}
+
+template <typename Array> void test_small_to_heap(const char *name) {
+    for (size_t size : test_sizes<Array>()) {
+        Array a = make<Array>(size);
+        check(has_contents(a, size));
+        check(is_inline(a) == (size > 0 && size <= Array::SmallSize));
+
+        // Copy construction allocates its own storage
+        Array b(a);
+        check(has_contents(b, size));
+        check(is_inline(b) == is_inline(a));
+        check(size == 0 || b.data() != a.data());
+
+        // Copy assignment across the transition in both directions
+        for (size_t size2 : test_sizes<Array>()) {
+            Array c = make<Array>(size2, 7);
+            c = a;
+            check(has_contents(c, size));
+            check(is_inline(c) == is_inline(a));
+            check(has_contents(a, size));
+
+            Array d = make<Array>(size, 3);
+            d = make<Array>(size2, 5);
+            check(has_contents(d, size2, 5));
+            check(is_inline(d) == (size2 > 0 && size2 <= Array::SmallSize));
+        }
+    }
+}
+
+template <typename Array> void test_move(const char *name) {
+    for (size_t size : test_sizes<Array>()) {
+        // Move construction
+        Array a = make<Array>(size);
+        const void *ptr = a.data();
+        bool was_inline = is_inline(a);
+
+        Array b(std::move(a));
+        check(has_contents(b, size));
+        check(a.size() == 0 && a.data() == nullptr);
+        check(is_inline(b) == was_inline);
+        // Inline contents must be copied, heap storage must be stolen
+        check(was_inline ? b.data() != ptr : b.data() == ptr);
+
+        // Move assignment into inline, heap, and empty targets
+        for (size_t size2 : test_sizes<Array>()) {
+            Array c = make<Array>(size, 2);
+            ptr = c.data();
+            was_inline = is_inline(c);
+
+            Array d = make<Array>(size2, 9);
+            d = std::move(c);
+            check(has_contents(d, size, 2));
+            check(c.size() == 0 && c.data() == nullptr);
+            check(is_inline(d) == was_inline);
+            check(was_inline ? d.data() != ptr : d.data() == ptr);
+
+            // The moved-from array remains usable
+            c = make<Array>(size2, 4);
+            check(has_contents(c, size2, 4));
+        }
+
+        // Self-assignment is a no-op
+        Array e = make<Array>(size);
+        Array &e_ref = e;
+        e = std::move(e_ref);
+        check(has_contents(e, size));
+        e = e_ref;
+        check(has_contents(e, size));
+    }
+}
+
+template <typename Array> void test_alignment(const char *name) {
+    for (size_t size = 1; size < 300; size = size * 2 + 1) {
+        Array a = make<Array>(size);
+        check(((uintptr_t) a.data() % alignof(dr::value_t<Array>)) == 0);
+        if (!is_inline(a))
+            check(((uintptr_t) a.data() % Array::Alignment) == 0);
+
+        // Results of arithmetic operations use the same allocator
+        Array b = a + a;
+        if (!is_inline(b))
+            check(((uintptr_t) b.data() % Array::Alignment) == 0);
+    }
+}
+
+template <typename Value> void bind(nb::module_ &m, const char *name) {
+    using Array = dr::DynamicArray<Value>;
+    nb::module_ sm = m.def_submodule(name);
+    sm.attr("small_size") = Array::SmallSize;
+    sm.def("test_small_to_heap", [name]() { test_small_to_heap<Array>(name); });
+    sm.def("test_move", [name]() { test_move<Array>(name); });
+    sm.def("test_alignment", [name]() { test_alignment<Array>(name); });
+}
+
+NB_MODULE(dynamic_ext, m) {
+    nb::module_::import_("drjit");
+
+    bind<uint8_t>(m, "uint8");
+    bind<uint32_t>(m, "uint32");
+    bind<float>(m, "float32");
+    bind<double>(m, "float64");
+}
@@ -0,0 +1,42 @@
+#define NB_INTRUSIVE_EXPORT NB_IMPORT
+
+#include <nanobind/nanobind.h>
+#include <drjit/math.h>
+#include <drjit/autodiff.h>
+
+namespace nb = nanobind;
+namespace dr = drjit;
+
+template <typename Float>
+void bind(nb::module_ &m) {
+    nb::module_ fast = m.def_submodule("fast"),
+                approx = m.def_submodule("approx");
+
+    fast.def("exp", [](const Float &x) { return dr::fast::exp(x); });
+    fast.def("exp2", [](const Float &x) { return dr::fast::exp2(x); });
+    fast.def("log", [](const Float &x) { return dr::fast::log(x); });
+    fast.def("log2", [](const Float &x) { return dr::fast::log2(x); });
+    fast.def("sin", [](const Float &x) { return dr::fast::sin(x); });
+    fast.def("cos", [](const Float &x) { return dr::fast::cos(x); });
+
+    approx.def("exp", [](const Float &x) { return dr::approx::exp(x); });
+    approx.def("exp2", [](const Float &x) { return dr::approx::exp2(x); });
+    approx.def("log", [](const Float &x) { return dr::approx::log(x); });
+    approx.def("log2", [](const Float &x) { return dr::approx::log2(x); });
+    approx.def("sin", [](const Float &x) { return dr::approx::sin(x); });
+    approx.def("cos", [](const Float &x) { return dr::approx::cos(x); });
+}
+
+NB_MODULE(math_ext, m) {
+    nb::module_::import_("drjit");
+
+#if defined(DRJIT_ENABLE_LLVM)
+    nb::module_ llvm = m.def_submodule("llvm");
+    bind<dr::DiffArray<JitBackend::LLVM, float>>(llvm);
+#endif
+
+#if defined(DRJIT_ENABLE_CUDA)
+    nb::module_ cuda = m.def_submodule("cuda");
+    bind<dr::DiffArray<JitBackend::CUDA, float>>(cuda);
+#endif
+}
@@ -487,3 +487,22 @@ def test24_mul_hi_wide(t, opaque):
     e_s = dr.mul_wide(a_s, b_s)
 
     assert dr.all(e == e_s)
+
+@pytest.test_arrays('-bool, shape=(*)')
+def test25_scalar_operand(t):
+    # Operations with Python scalars take a shortcut when the result has the
+    # array's type. Check that they produce the same results as the general case
+    a = t(0, 1, 2)
+    Float = dr.float32_array_t(t) if dr.is_integral_v(t) else t
+
+    for v in (2, 2.5):
+        tp = Float if isinstance(v, float) else t
+        for r in (a + v, v + a, a * v, v * a, a - v, v - a):
+            assert type(r) is tp
+        assert dr.all(a + v == tp(v, 1 + v, 2 + v))
+        assert dr.all(v - a == tp(v, v - 1, v - 2))
+        assert dr.all((a < v) == dr.mask_t(t)(True, True, v > 2))
+
+    b = t(a)
+    b += 1
+    assert type(b) is t and dr.all(b == t(1, 2, 3))
@@ -145,3 +145,38 @@ def test11_conversion_ad(t):
     assert dr.grad_enabled(x)
     assert i != 0
     assert i == x.index_ad
+
+
+@pytest.mark.parametrize('protocol', [4, 5])
+@pytest.test_arrays('float32,shape=(*)', 'uint32,shape=(*)',
+                    'float32,shape=(3, *)', 'float32,tensor')
+def test12_pickle(t, protocol):
+    import pickle
+    if dr.is_tensor_v(t):
+        x = dr.arange(dr.array_t(t), 24)
+        x = t(x, (2, 3, 4))
+    elif dr.depth_v(t) > 1:
+        x = t(dr.arange(dr.value_t(t), 5), 1, 2)
+    else:
+        x = dr.arange(t, 10)
+
+    # In-band data
+    y = pickle.loads(pickle.dumps(x, protocol=protocol))
+    assert type(y) is type(x) and dr.shape(y) == dr.shape(x)
+    assert dr.all(x == y, axis=None)
+
+    if protocol < 5:
+        return
+
+    # Out-of-band data, the receiver may map the buffers without copying
+    buffers = []
+    data = pickle.dumps(x, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    buffers = [bytearray(b.raw()) for b in buffers]
+    y = pickle.loads(data, buffers=buffers)
+    assert type(y) is type(x) and dr.shape(y) == dr.shape(x)
+    assert dr.all(x == y, axis=None)
+
+    # Read-only buffers are copied
+    y = pickle.loads(data, buffers=[bytes(b) for b in buffers])
+    assert dr.all(x == y, axis=None)
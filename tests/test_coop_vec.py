@@ -699,3 +699,46 @@ def test25_suspend_grad(t):
     with dr.suspend_grad():
         z = nn.CoopVec(x, y)
 
+
+
+@pytest.mark.parametrize('transpose', [False, True])
+@pytest.mark.parametrize('expand', [False, True])
+@pytest.test_arrays('jit,tensor,float16,diff', 'jit,tensor,float32,diff')
+def test26_matvec_bwd_accum(t, transpose, expand):
+    # Test that the reverse-mode derivative correctly accumulates the
+    # matrix/bias gradients of many lanes (row-major layout), both with
+    # ReduceMode.Expand and with the atomic fallback
+    if dr.backend_v(t) == dr.JitBackend.CUDA:
+        pytest.skip("Unsupported configuration")
+
+    m = sys.modules[t.__module__]
+    Float = dr.array_t(t)
+    A = t([[1, 3, 2], [-2, 4, 1]])
+    b = t([0, 0, 0] if transpose else [0, 0])
+    buffer, Av, bv = nn.pack(A, b)
+    dr.enable_grad(buffer)
+
+    # Keep all partial sums exactly representable in half precision
+    n = 128 if dr.type_v(t) == dr.VarType.Float16 else 1000
+    lane = dr.arange(m.UInt32, n) % 4
+    x = [Float(lane) * (i + 1) for i in range(2 if transpose else 3)]
+
+    expand_prev = dr.detail.coop_vec_expand()
+    dr.detail.set_coop_vec_expand(expand)
+    try:
+        y = list(nn.matvec(Av.T if transpose else Av, nn.CoopVec(x), bv))
+        loss = 0
+        for i, yi in enumerate(y):
+            loss += dr.sum(yi) * (i + 1)
+        dr.backward_from(loss)
+        _, grad_A, grad_b = nn.unpack(Av.grad, bv.grad)
+        dr.eval(grad_A, grad_b)
+    finally:
+        dr.detail.set_coop_vec_expand(expand_prev)
+
+    # d loss / d A[i, j] = sum over lanes of (i + 1) * (j + 1) * (lane % 4)
+    s = sum(k % 4 for k in range(n))
+    grad_A_ref = t([[(i + 1) * (j + 1) * s for j in range(3)] for i in range(2)])
+    grad_b_ref = t([n * (i + 1) for i in range(len(y))])
+    assert dr.all(t(grad_A) == grad_A_ref, axis=None)
+    assert dr.all(t(grad_b)[:, 0] == grad_b_ref, axis=None)
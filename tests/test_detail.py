@@ -1,4 +1,6 @@
 import drjit as dr
+import pytest
+from dataclasses import dataclass
 
 
 def test01_jit_scope():
@@ -9,3 +11,35 @@ def test01_jit_scope():
 
     dr.detail.set_scope(backend, scope)
     assert dr.detail.scope(backend) == scope
+
+
+@pytest.test_arrays('float32,is_jit,shape=(*)')
+def test02_traverse_modified_type(t):
+    # Traversal information is cached per type, check that it is updated
+    # when the type changes
+    class MyStruct:
+        DRJIT_STRUCT = { 'a': t }
+
+        def __init__(self):
+            self.a, self.b = t(1), t(2)
+
+    s = MyStruct()
+    assert dr.detail.collect_indices(s) == [s.a.index]
+
+    MyStruct.DRJIT_STRUCT = { 'a': t, 'b': t }
+    assert dr.detail.collect_indices(s) == [s.a.index, s.b.index]
+
+    s2 = dr.detail.copy(s)
+    assert type(s2) is MyStruct and s2.b[0] == 2
+
+    @dataclass
+    class MyDataclass:
+        a: t
+        b: t
+
+    d = MyDataclass(t(3), t(4))
+    assert dr.detail.collect_indices(d) == [d.a.index, d.b.index]
+    assert dr.detail.collect_indices([d, d]) == [d.a.index, d.b.index] * 2
+
+    d2 = dr.detail.copy(d)
+    assert type(d2) is MyDataclass and d2.a[0] == 3 and d2.b[0] == 4
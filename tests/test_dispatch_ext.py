@@ -0,0 +1,34 @@
+import pytest
+
+@pytest.fixture
+def m():
+    m = pytest.importorskip("dispatch_ext")
+    yield m
+    m.set_isa_limit("none")
+
+
+def test01_detect(m):
+    # The baseline variant is always available, and the best available
+    # variant is selected by default
+    isas = m.available_isas()
+    assert isas[0] == "baseline"
+    assert m.isa() == m.detected_isa()
+    assert m.variant_name().lower() == isas[-1]
+
+
+def test02_force_each_isa(m):
+    # Force each compiled variant in turn and check that it computes the
+    # same result, including the non-vectorized remainder
+    sizes = { "baseline": None, "sse42": 4, "avx": 8, "avx2": 8, "avx512": 16 }
+    n = 37
+    x = [float(i) for i in range(n)]
+    y = [float(2 * i + 1) for i in range(n)]
+    ref = [3 * a + b for a, b in zip(x, y)]
+
+    for isa in m.available_isas():
+        m.set_isa_limit(isa)
+        assert m.isa() == isa
+        assert m.variant_name().lower() == isa
+        if sizes[isa] is not None:
+            assert m.packet_size() == sizes[isa]
+        assert m.saxpy(3, x, y) == ref
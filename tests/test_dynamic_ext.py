@@ -0,0 +1,36 @@
+"""
+Tests of the inline (small buffer) and heap storage of the C++
+``dr::DynamicArray`` type.
+"""
+
+import drjit as dr
+import pytest
+
+types = ['uint8', 'uint32', 'float32', 'float64']
+
+def get_pkg(name):
+    with dr.detail.scoped_rtld_deepbind():
+        m = pytest.importorskip("dynamic_ext")
+    return getattr(m, name)
+
+
+@pytest.mark.parametrize('name', types)
+def test01_small_to_heap(name):
+    # Growing and shrinking across the inline capacity, via copy
+    # construction and copy assignment
+    pkg = get_pkg(name)
+    assert pkg.small_size > 0
+    pkg.test_small_to_heap()
+
+
+@pytest.mark.parametrize('name', types)
+def test02_move_from_small(name):
+    # Move construction and assignment must copy inline contents
+    # and steal heap storage
+    get_pkg(name).test_move()
+
+
+@pytest.mark.parametrize('name', types)
+def test03_heap_alignment(name):
+    get_pkg(name).test_alignment()
+
@@ -265,4 +265,28 @@ def test13_evaluated_print(t):
     j = t([2, 1, 0])
     b = AppendBuffer()
     foo(i, b, j < 2)
-    assert b.value == '[2]'
\ No newline at end of file
+    assert b.value == '[2]'
+
+@pytest.test_arrays('shape=(*), uint32, jit')
+def test14_deferred_print(t):
+    b = AppendBuffer()
+    for i in range(3):
+        dr.print(t([1, 2, 3]) + i, file=b, end='|', mode='symbolic', defer=True)
+        dr.eval()
+    assert b.value is None
+    dr.flush_print()
+    assert b.value == '[1, 2, 3]|[2, 3, 4]|[3, 4, 5]|'
+    dr.flush_print()
+    assert b.value == '[1, 2, 3]|[2, 3, 4]|[3, 4, 5]|'
+
+
+@pytest.test_arrays('shape=(*), uint32, jit')
+def test15_rate_limited_print(t):
+    # Rate limits are tracked per format string (including 'end')
+    for mode in ('symbolic', 'evaluate'):
+        b = AppendBuffer()
+        end = f' {t.__module__} {mode}\n'
+        for i in range(3):
+            dr.print(t(i), file=b, end=end, mode=mode, rate_limit=1e-3)
+            dr.eval()
+        assert b.value == '[0]' + end
@@ -3874,3 +3874,237 @@ def test103_rng(t, auto_opaque):
     ref = func(dr.rng(42), x)
     assert dr.allclose(ref, res)
 
+
+@pytest.mark.parametrize("auto_opaque", [False, True])
+@pytest.test_arrays("float32, jit, shape=(*)")
+def test104_stats(t, auto_opaque):
+    """
+    Tests that the statistics of a frozen function track recordings, replays,
+    evictions, per-recording hits and phase timings.
+    """
+    def func(x):
+        return x + 1
+
+    frozen = dr.freeze(func, auto_opaque=auto_opaque, limit=1)
+
+    for i in range(3):
+        x = dr.arange(t, i + 3)
+        assert dr.allclose(func(x), frozen(x))
+
+    stats = frozen.stats
+    assert stats.n_calls == 3
+    assert stats.n_records == 1
+    assert stats.n_replays == 2
+    assert stats.n_evictions == 0
+    assert stats.hits == {0: 2}
+    assert stats.traverse_input.count >= 3
+    assert stats.function.count == 1
+    assert stats.replay.count == 2
+    assert stats.total.total >= stats.total.last > 0
+
+    # Changing the type of the input evicts the previous recording
+    x = dr.arange(dr.uint32_array_t(t), 3)
+    frozen(x)
+
+    stats = frozen.stats
+    assert stats.n_records == 2
+    assert stats.n_evictions == 1
+    assert stats.hits == {1: 0}
+
+    frozen.clear()
+    stats = frozen.stats
+    assert stats.n_calls == 0
+    assert stats.n_records == 0
+    assert stats.hits == {}
+
+
+@pytest.test_arrays("float32, jit, shape=(*)")
+def test105_stats_auto_opaque(t):
+    """
+    Tests that repeated input traversals due to the auto-opaque feature are
+    counted by the frozen function statistics.
+    """
+    def func(x, y):
+        return x + y
+
+    frozen = dr.freeze(func, auto_opaque=True)
+
+    x = dr.arange(t, 10)
+    for i in range(3):
+        frozen(x, t(i))
+
+    stats = frozen.stats
+    assert stats.n_calls == 3
+    assert stats.n_auto_opaque_retraversals >= 1
+    assert stats.n_records + stats.n_replays == 3
+
+
+@pytest.mark.parametrize("auto_opaque", [False, True])
+@pytest.test_arrays("float32, jit, shape=(*)")
+def test106_symbolic_literal_size(t, auto_opaque):
+    """
+    Tests that literal inputs, whose size matches the size of an opaque input,
+    are treated as symbolic dimensions and do not trigger re-tracing when that
+    size changes, and that literal outputs derived from them have the size of
+    the current input.
+    """
+    def func(x, y):
+        return x + y
+
+    frozen = dr.freeze(func, auto_opaque=auto_opaque)
+
+    for i in range(4):
+        n = i + 3
+        x = dr.arange(t, n)
+        y = dr.full(t, 1, n)
+
+        res = frozen(x, y)
+        ref = func(x, y)
+
+        assert dr.width(res) == n
+        assert dr.allclose(res, ref)
+
+    assert frozen.n_recordings == 1
+
+    # A size of 1 changes broadcasting semantics and requires a new recording
+    x = dr.arange(t, 1)
+    y = dr.full(t, 1, 1)
+    res = frozen(x, y)
+    assert dr.width(res) == 1
+    assert frozen.n_recordings == 2
+
+    # A literal input that is returned as an output is replayed with the
+    # current input, rather than the one observed while recording
+    def func(x, y):
+        return x + y, y
+
+    frozen = dr.freeze(func, auto_opaque=auto_opaque)
+
+    for n in (3, 4, 10, 3):
+        x = dr.arange(t, n)
+        y = dr.full(t, 1, n)
+
+        res, y2 = frozen(x, y)
+
+        assert dr.width(res) == n and dr.allclose(res, x + 1)
+        assert dr.width(y2) == n and dr.all(y2 == 1)
+        # The unchanged input is assigned the current value as well
+        assert dr.width(y) == n
+
+    assert frozen.n_recordings == 1
+
+    # A literal output computed from a literal input (``y * 2`` is constant
+    # folded) must have the size of the current input
+    def func(x, y):
+        return x + y, y * 2
+
+    frozen = dr.freeze(func, auto_opaque=auto_opaque)
+
+    for n in (3, 4, 10, 3):
+        x = dr.arange(t, n)
+        y = dr.full(t, 1, n)
+
+        res, y2 = frozen(x, y)
+
+        assert dr.width(res) == n and dr.allclose(res, x + 1)
+        assert dr.width(y2) == n and dr.all(y2 == 2)
+
+
+@pytest.test_arrays("float32, jit, shape=(*)")
+def test107_constant_literal_output(t):
+    """
+    Tests that a literal output with a constant size is not bound to an input
+    dimension, even if both sizes coincide while recording.
+    """
+    def func(x):
+        return x + 1, dr.zeros(t, 3)
+
+    frozen = dr.freeze(func)
+
+    for n in (3, 1000, 3):
+        x = dr.arange(t, n)
+        res, z = frozen(x)
+
+        assert dr.width(res) == n
+        assert dr.allclose(res, x + 1)
+        assert dr.width(z) == 3
+        assert dr.all(z == 0)
+
+    assert frozen.n_recordings == 1
+
+
+@pytest.test_arrays("float32, jit, diff, shape=(*)")
+@pytest.mark.parametrize("auto_opaque", [False, True])
+def test108_optimizer_stochastic_rounding(t, auto_opaque):
+    """
+    Tests that the random number generator used for stochastic rounding is
+    part of the optimizer state, so that replaying a frozen step advances it.
+    Otherwise, each replay would draw the same samples.
+    """
+    t16 = dr.float16_array_t(t)
+
+    def func(target, opt):
+        loss = dr.mean(dr.square(t(opt["x"]) - target))
+        dr.backward(loss)
+        opt.step()
+        return opt["x"]
+
+    frozen = dr.freeze(func, auto_opaque=auto_opaque)
+
+    opts = [Adam(lr=1e-3, promote_fp16=False, stochastic_rounding=True)
+            for _ in range(2)]
+    for opt in opts:
+        opt["x"] = dr.linspace(t16, 0, 1, 1000)
+
+    target = dr.full(t, 2, 1000)
+
+    for i in range(6):
+        res = frozen(target, opts[0])
+        ref = func(target, opts[1])
+
+        assert dr.all(res == ref)
+        assert dr.all(opts[0].rng._counter == opts[1].rng._counter)
+
+    assert frozen.n_recordings < 6
+
+
+@pytest.test_arrays("float32, jit, diff, shape=(*)")
+@pytest.mark.parametrize("optimizer", ["sdg", "adam"])
+def test109_optimizer_fused(t, optimizer):
+    """
+    Tests that a frozen step of an optimizer in fused mode matches the
+    unfused optimizer. The arenas are not part of the traversed state, hence
+    the frozen function must not use them.
+    """
+
+    def func(target, opt):
+        loss = dr.mean(dr.square(opt["x"] - target)) + \
+               dr.mean(dr.square(opt["y"] - target))
+        dr.backward(loss)
+        opt.step()
+        return opt["x"], opt["y"]
+
+    def init_optimizer(fused):
+        if optimizer == "sdg":
+            opt = SGD(lr=0.01, momentum=0.9, fused=fused)
+        else:
+            opt = Adam(lr=0.01, fused=fused)
+        opt["x"] = dr.linspace(t, 0, 1, 10)
+        opt["y"] = dr.linspace(t, -1, 0, 7)
+        return opt
+
+    frozen = dr.freeze(func)
+    opt_frozen = init_optimizer(True)
+    opt_ref = init_optimizer(False)
+    target = dr.full(t, 2, 10)
+
+    for i in range(5):
+        res = frozen(target, opt_frozen)
+        ref = func(target, opt_ref)
+        assert dr.allclose(res, ref)
+
+    # A subsequent step outside of the frozen function uses the arena again
+    func(target, opt_frozen)
+    func(target, opt_ref)
+    assert dr.allclose(opt_frozen["x"], opt_ref["x"])
+    assert dr.allclose(opt_frozen["y"], opt_ref["y"])
@@ -0,0 +1,93 @@
+import drjit as dr
+import pytest
+import sys
+from dataclasses import dataclass
+
+
+@dataclass
+class Record:
+    value: object
+    scale: float
+
+
+class Struct:
+    DRJIT_STRUCT = { 'x': object, 'y': object }
+
+    def __init__(self, x=None, y=None):
+        self.x, self.y = x, y
+
+
+@pytest.mark.parametrize('mmap', [True, False])
+@pytest.test_arrays('float32,is_jit,shape=(*)')
+def test01_save_load(t, tmp_path, mmap):
+    mod = sys.modules[t.__module__]
+    UInt32, Array3f, TensorXf = dr.uint32_array_t(t), mod.Array3f, mod.TensorXf
+
+    value = {
+        'a': dr.arange(t, 1000),
+        'b': UInt32(1, 2, 3),
+        'c': Array3f(1, 2, 3),
+        'd': TensorXf(dr.arange(t, 24), (2, 3, 4)),
+        'e': [t(), None, 1, 2.5, 'text', (True, False)],
+        'f': Record(dr.arange(t, 5), 0.5),
+        'g': Struct(t(4), dr.mask_t(t)(True, False, True)),
+        1: 'int key'
+    }
+
+    path = tmp_path / 'test.drjit'
+    dr.save(path, value)
+    r = dr.load(path, mmap=mmap, chunk_size=256, types=(Record, Struct))
+
+    assert type(r['a']) is t and dr.all(r['a'] == value['a'])
+    assert type(r['b']) is UInt32 and dr.all(r['b'] == value['b'])
+    assert type(r['c']) is Array3f and dr.all(r['c'] == value['c'], axis=None)
+    assert type(r['d']) is TensorXf and r['d'].shape == (2, 3, 4)
+    assert dr.all(r['d'] == value['d'], axis=None)
+    assert len(r['e'][0]) == 0 and r['e'][1:] == [None, 1, 2.5, 'text', (True, False)]
+    assert type(r['f']) is Record and r['f'].scale == 0.5
+    assert dr.all(r['f'].value == value['f'].value)
+    assert type(r['g']) is Struct and dr.all(r['g'].x == 4)
+    assert dr.all(r['g'].y == value['g'].y)
+    assert r[1] == 'int key'
+
+    # Loaded arrays can be modified without affecting the file
+    x = r['a']
+    dr.scatter(x, t(-1), UInt32(0))
+    assert x[0] == -1
+    assert dr.load(path, types=(Record, Struct))['a'][0] == 0
+
+
+def test02_load_invalid(tmp_path):
+    path = tmp_path / 'test.drjit'
+    path.write_bytes(b'not a Dr.Jit file')
+    with pytest.raises(RuntimeError, match='not a Dr.Jit file'):
+        dr.load(path)
+
+
+def write_header(path, tree):
+    import json, struct
+    from drjit._io import MAGIC, VERSION
+    header = json.dumps(tree).encode('utf-8')
+    path.write_bytes(MAGIC + struct.pack('<IIQ', VERSION, 0, len(header)) + header)
+
+
+@pytest.test_arrays('float32,is_jit,shape=(*)')
+def test03_load_reject_types(t, tmp_path):
+    path = tmp_path / 'test.drjit'
+
+    # Nodes that name arbitrary callables must not be invoked
+    write_header(path, {'nested': {'type': ['os', 'system'],
+                                   'items': [{'value': 'echo pwned'}]}})
+    with pytest.raises(RuntimeError, match='refusing to load non-Dr.Jit type'):
+        dr.load(path)
+
+    write_header(path, {'array': {'type': ['drjit', 'load'], 'dtype': 'Float32',
+                                  'shape': [0], 'offset': 0, 'nbytes': 0}})
+    with pytest.raises(RuntimeError, match='is not a Dr.Jit array type'):
+        dr.load(path)
+
+    # Data classes must be listed explicitly
+    dr.save(path, Record(t(1, 2), 0.5))
+    with pytest.raises(RuntimeError, match="was not specified via the 'types'"):
+        dr.load(path)
+    assert type(dr.load(path, types=(Record,))) is Record
@@ -0,0 +1,84 @@
+import drjit as dr
+import pytest
+
+def get_pkg(t):
+    with dr.detail.scoped_rtld_deepbind():
+        m = pytest.importorskip("math_ext")
+    backend = dr.backend_v(t)
+    if backend == dr.JitBackend.LLVM:
+        return m.llvm
+    elif backend == dr.JitBackend.CUDA:
+        return m.cuda
+
+
+def rel_err(value, ref):
+    Float64 = dr.float64_array_t(type(value))
+    value, ref = Float64(value), Float64(ref)
+    return dr.max(dr.abs(value - ref) / dr.maximum(dr.abs(ref), 1e-30))[0]
+
+
+def abs_err(value, ref):
+    Float64 = dr.float64_array_t(type(value))
+    return dr.max(dr.abs(Float64(value) - Float64(ref)))[0]
+
+
+# Error bounds of the two tiers in single precision (with some slack)
+bounds = { 'fast': 5 * 2**-23, 'approx': 2e-5 }
+
+
+def skip_cuda(t):
+    # The CUDA backend retains its hardware approximations, whose
+    # accuracy is not covered by the bounds above
+    if dr.backend_v(t) == dr.JitBackend.CUDA:
+        pytest.skip("Uses hardware approximations on CUDA")
+
+
+@pytest.mark.parametrize('tier', ['fast', 'approx'])
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test01_exp_log(t, tier):
+    skip_cuda(t)
+    m = getattr(get_pkg(t), tier)
+    Float64 = dr.float64_array_t(t)
+
+    x = dr.linspace(t, -20, 30, 100000)
+    assert rel_err(m.exp(x), dr.exp(Float64(x))) < bounds[tier]
+    assert rel_err(m.exp2(x), dr.exp2(Float64(x))) < bounds[tier]
+
+    x = dr.linspace(t, 1e-3, 1000, 100000)
+    assert rel_err(m.log(x), dr.log(Float64(x))) < bounds[tier]
+    assert rel_err(m.log2(x), dr.log2(Float64(x))) < bounds[tier]
+
+
+@pytest.mark.parametrize('tier', ['fast', 'approx'])
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test02_sin_cos(t, tier):
+    skip_cuda(t)
+    m = getattr(get_pkg(t), tier)
+    Float64 = dr.float64_array_t(t)
+
+    x = dr.linspace(t, -100, 100, 100000)
+    assert abs_err(m.sin(x), dr.sin(Float64(x))) < bounds[tier]
+    assert abs_err(m.cos(x), dr.cos(Float64(x))) < bounds[tier]
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test03_special_values(t):
+    m = get_pkg(t).approx
+    inf, nan = float('inf'), float('nan')
+
+    assert dr.all(m.exp(t(-inf, 100, -100)) == t(0, inf, 0))
+    assert dr.all(m.log(t(0, inf)) == t(-inf, inf))
+    assert dr.all(dr.isnan(m.log(t(-1, nan))))
+
+
+@pytest.test_arrays('float32,is_diff,shape=(*)')
+def test04_ad_fallback(t):
+    # With gradient tracking, the reduced-accuracy functions defer to the
+    # default differentiable implementation
+    m = get_pkg(t).approx
+    x = dr.linspace(t, -1, 1, 10)
+    dr.enable_grad(x)
+    y = m.exp(x)
+    assert dr.all(y == dr.exp(x))
+    dr.backward(y)
+    assert dr.allclose(dr.grad(x), dr.exp(x))
@@ -1374,3 +1374,23 @@ def test42_masked_gather_loop(t, mode):
     # Lane 2: outputs 0 because the gather on buf_1 masked it
 
     assert dr.all(out == [0, 5, 0], axis=None)
+
+
+@pytest.mark.parametrize('side', ['left', 'right'])
+@pytest.mark.parametrize('layout', [False, True])
+@pytest.test_arrays('float32,is_jit,shape=(*)', 'int32,is_jit,shape=(*)')
+def test43_searchsorted(t, side, layout):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(0)
+    dtype = np.float32 if dr.is_float_v(t) else np.int32
+
+    for n in (0, 1, 2, 3, 7, 8, 9, 100, 1023, 1024):
+        table = np.sort(rng.integers(0, 50, n)).astype(dtype)
+        query = np.arange(-2, 53).astype(dtype)
+
+        sorted = t(table)
+        eytzinger = dr.eytzinger(sorted) if layout else None
+        result = dr.searchsorted(sorted, t(query), side=side,
+                                 eytzinger=eytzinger)
+        ref = np.searchsorted(table, query, side=side)
+        assert np.all(result.numpy() == ref)
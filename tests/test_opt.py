@@ -1,6 +1,7 @@
 import drjit as dr
 from drjit.opt import Adam, SGD, RMSProp, AdamW, GradScaler
 import pytest
+import sys
 
 
 @pytest.test_arrays("is_diff,float,shape=(*)")
@@ -432,3 +433,177 @@ def test12_promote_fp16(optimizer_class, promote_fp16, t):
     if not success:
         print(f"  Target: {target}, Final: {final_value[0]:.8f}")
     assert success
+
+
+@pytest.mark.parametrize("optimizer", [
+    lambda **kw: SGD(lr=1e-2, **kw),
+    lambda **kw: SGD(lr=1e-2, momentum=0.9, nesterov=True, **kw),
+    lambda **kw: RMSProp(lr=1e-2, **kw),
+    lambda **kw: Adam(lr=1e-2, **kw),
+    lambda **kw: Adam(lr=1e-2, amsgrad=True, mask_updates=True, **kw),
+    lambda **kw: AdamW(lr=1e-2, **kw),
+])
+@pytest.test_arrays("is_diff,float32,shape=(*)")
+def test13_fused(optimizer, t):
+    # Fused and per-parameter steps should produce the same result
+    tt = dr.tensor_t(t)
+    Array3f = sys.modules[t.__module__].Array3f
+    params = {
+        'a': t(1, 2, 3),
+        'b': dr.full(tt, 0.5, (2, 3)),
+        'c': t(4),
+        'n': Array3f(1, 2, 3)  # Nested arrays are updated separately
+    }
+
+    opts = [optimizer(fused=False), optimizer(fused=True)]
+
+    def loss(opt):
+        return (dr.sum(dr.square(opt['a'] - 1)) +
+                dr.sum(dr.square(opt['b'].array * t(0, 1, 2, 3, 4, 5))) +
+                dr.sum(opt['c'] * 3) + dr.sum(dr.square(opt.get('d', t(0)))) +
+                dr.sum(dr.squared_norm(opt['n'])))
+
+    for opt in opts:
+        opt.update(params)
+        opt.set_learning_rate(b=2e-2)
+
+    for it in range(6):
+        if it == 2:
+            # Register another parameter, and project an existing one
+            for opt in opts:
+                opt['d'] = t(3, 4)
+                opt['a'] = dr.clip(opt['a'], 0, 2)
+        if it == 4:
+            for opt in opts:
+                del opt['c']
+                opt.set_learning_rate(a=5e-3)
+
+        for opt in opts:
+            dr.backward(loss(opt))
+            opt.step()
+
+        for k in opts[0].keys():
+            assert dr.allclose(opts[0][k], opts[1][k])
+            e0, e1 = opts[0].state[k][3], opts[1].state[k][3]
+            if not isinstance(e0, tuple):
+                e0, e1 = (e0,), (e1,)
+            for v0, v1 in zip(e0, e1):
+                if v0 is not None:
+                    assert dr.allclose(v0, v1)
+
+    assert list(opts[1].arenas.values())[0].keys == ['a', 'b', 'd']
+
+
+@pytest.test_arrays("is_diff,float32,shape=(*)")
+def test14_stochastic_rounding(t):
+    # Stochastically rounded values should be unbiased on average
+    t16 = dr.float16_array_t(t)
+    opt = Adam(lr=1e-3, stochastic_rounding=True)
+    n = 100000
+
+    for x in (1 + 2**-12, 1 - 2**-13, -(1 + 2**-12), 2**-26, 1):
+        value = dr.full(t, x, n)
+        rounded = t(opt._round(value, t16))
+        assert abs(dr.mean(rounded)[0] - x) < 1e-5 * max(abs(x), 2**-14)
+
+
+@pytest.mark.parametrize("optimizer_class", [SGD, RMSProp, Adam])
+@pytest.test_arrays("is_diff,float32,shape=(*)")
+def test15_half_precision_state(optimizer_class, t):
+    t16 = dr.float16_array_t(t)
+    kwargs = {'momentum': 0.9} if optimizer_class is SGD else {}
+
+    # Half precision state should track the single precision optimizer
+    opts = [
+        optimizer_class(lr=1e-2, **kwargs),
+        optimizer_class(lr=1e-2, state_fp16=True, stochastic_rounding=True, **kwargs)
+    ]
+    for opt in opts:
+        opt['x'] = dr.linspace(t, 0, 1, 16)
+
+    for _ in range(100):
+        for opt in opts:
+            dr.backward(dr.sum(dr.square(opt['x'] - 2)))
+            opt.step()
+
+    extra = opts[1].state['x'][3]
+    if isinstance(extra, tuple):
+        extra = extra[1]
+    assert type(extra) is t16
+    assert dr.allclose(opts[0]['x'], opts[1]['x'], rtol=1e-2)
+
+    # Half precision parameters should still converge with stochastic rounding
+    opt = optimizer_class(lr=1e-2, promote_fp16=False, stochastic_rounding=True, **kwargs)
+    opt['x'] = t16(100)
+    for _ in range(200):
+        dr.backward((opt['x'] - 101) ** 2)
+        opt.step()
+
+    assert dr.type_v(opt.state['x'][0]) == dr.VarType.Float16
+    assert abs(opt['x'][0] - 101) < 0.1
+
+
+@pytest.mark.parametrize("amsgrad", [False, True])
+@pytest.test_arrays("is_diff,float32,shape=(*)")
+def test16_lazy_adam(amsgrad, t):
+    import math
+    opt = Adam(lr=0.1, lazy=True, amsgrad=amsgrad)
+    opt['x'] = t(1, 2, 3, 4)
+    grads = [(1, 0, 0, 2), (0, 0, 0, 1), (3, 0, 1, 0), (0, 0, 0, 0), (1, 1, 1, 1)]
+
+    # Reference: dense Adam that only moves entries with a nonzero gradient.
+    # The moments of the other entries decay as if their gradient was zero.
+    b1, b2 = opt.beta_1, opt.beta_2
+    x, m, v, v_max = [1.0, 2.0, 3.0, 4.0], [0.0] * 4, [0.0] * 4, [0.0] * 4
+
+    for it, g in enumerate(grads):
+        opt['x'].grad = t(*g)
+        opt.step()
+
+        ti = it + 1
+        for i in range(4):
+            m[i] = b1 * m[i] + (1 - b1) * g[i]
+            v[i] = b2 * v[i] + (1 - b2) * g[i]**2
+            if g[i] != 0:
+                v_max[i] = max(v_max[i], v[i])
+                v_i = v_max[i] if amsgrad else v[i]
+                x[i] -= 0.1 * math.sqrt(1 - b2**ti) / (1 - b1**ti) * \
+                    m[i] / math.sqrt(v_i + 1e-16)
+
+        assert dr.allclose(opt['x'], x)
+
+        # The moments of the remaining entries are only updated on demand
+        _, m_t, v_t, _, last = opt.state['x'][3]
+        for i in range(4):
+            if g[i] != 0:
+                assert dr.allclose(m_t[i], m[i]) and dr.allclose(v_t[i], v[i])
+                assert last[i] == ti
+
+
+@pytest.test_arrays("is_diff,float32,shape=(*)")
+def test17_lazy_adamw(t):
+    import math
+    opt = AdamW(lr=0.1, weight_decay=0.5, lazy=True)
+    opt['x'] = t(1, 2, 3, 4)
+    grads = [(1, 0, 0, 2), (0, 0, 0, 1), (3, 0, 1, 0), (0, 0, 0, 0), (1, 1, 1, 1)]
+
+    # Reference: the weight decay of skipped iterations is applied when an
+    # entry is next updated, entries without a gradient keep their value
+    b1, b2, decay = opt.beta_1, opt.beta_2, 1 - 0.1 * 0.5
+    x, m, v, k = [1.0, 2.0, 3.0, 4.0], [0.0] * 4, [0.0] * 4, [0] * 4
+
+    for it, g in enumerate(grads):
+        opt['x'].grad = t(*g)
+        opt.step()
+
+        ti = it + 1
+        for i in range(4):
+            m[i] = b1 * m[i] + (1 - b1) * g[i]
+            v[i] = b2 * v[i] + (1 - b2) * g[i]**2
+            k[i] += 1
+            if g[i] != 0:
+                x[i] = x[i] * decay**k[i] - 0.1 * math.sqrt(1 - b2**ti) / \
+                    (1 - b1**ti) * m[i] / math.sqrt(v[i] + 1e-16)
+                k[i] = 0
+
+        assert dr.allclose(opt['x'], x)
@@ -464,6 +464,30 @@ def test13_test_prefix_reduction(t, reverse, exclusive):
     test_red((9, 5, 7), 2)
     test_red((9, 5, 7), -1)
 
+@pytest.test_arrays('tensor, uint32, jit, -diff')
+def test14_tensor_reduce_transposed(t):
+    np = pytest.importorskip("numpy")
+    import itertools
+    from drjit._reduce import tiled_transpose
+
+    for shape in [(300, 7), (7, 300), (5, 100, 3), (2, 3, 37, 70)]:
+        x_n = np.arange(np.prod(shape), dtype=np.uint32).reshape(shape) % 17
+        x = t(x_n)
+
+        # Reorder the entries of the tensor
+        for perm in itertools.permutations(range(len(shape))):
+            y = tiled_transpose(x.array, shape, perm, tile=16)
+            assert np.all(y.numpy() == np.transpose(x_n, perm).ravel())
+
+        # Reduce along all combinations of axes. Some of them use the strategy
+        # that transposes the input and then calls dr.block_reduce()
+        for i in range(1, len(shape)):
+            for axis in itertools.combinations(range(len(shape)), i):
+                y = dr.reduce(dr.ReduceOp.Add, x, axis, 'evaluated')
+                assert np.all(y.numpy() == x_n.sum(axis=axis))
+                y = dr.reduce(dr.ReduceOp.Max, x, axis, 'evaluated')
+                assert np.all(y.numpy() == x_n.max(axis=axis))
+
 @pytest.test_arrays('jit, uint32, shape=(*)')
 def test20_concat_array(t):
     assert dr.all(dr.concat((t(1,2,3), t(4,5,6))) == t(1,2,3,4,5,6))
@@ -113,3 +113,19 @@ def test07_convolve(t):
     y = dr.convolve(x, 'linear', 2)
     z = t((1+2*.5)/1.5, (1*.5+2+10*.5)/2, (2*.5+10+100*.5)/2, (100+10*.5)/1.5)
     assert dr.allclose(y, z)
+
+# Resampling two adjacent axes of a CPU tensor uses a fused implementation,
+# which should match two separate resampling steps
+@pytest.mark.parametrize('filter', ['box', 'linear', 'cubic', 'lanczos'])
+@pytest.test_arrays('float32, -jit, tensor')
+def test08_resample_2d(t, filter):
+    np = pytest.importorskip("numpy")
+    np.random.seed(0)
+    x = t(np.float32(np.random.rand(2, 37, 23, 3)))
+
+    for shape in [(2, 10, 50, 3), (2, 80, 7, 3)]:
+        y = dr.resample(x, shape, filter=filter)
+        y_ref = dr.resample(x, (2, 37, shape[2], 3), filter=filter)
+        y_ref = dr.resample(y_ref, shape, filter=filter)
+        assert y.shape == shape
+        assert dr.allclose(y, y_ref)
@@ -686,3 +686,243 @@ def test23_item_array(t):
 
     with pytest.raises(RuntimeError, match='can only convert arrays of length 1'):
         t([]).item()
+
+
+@pytest.test_arrays('is_tensor, jit, float32')
+def test24_strided_views(t):
+    np = pytest.importorskip("numpy")
+
+    shape = (4, 5, 6)
+    v0 = t(dr.arange(dr.array_t(t), dr.prod(shape)), shape)
+    v1 = np.arange(dr.prod(shape), dtype=np.float32).reshape(shape)
+
+    def layout(a):
+        # Strides and offset of a NumPy view in elements
+        offset = a.__array_interface__['data'][0] - \
+                 v1.__array_interface__['data'][0]
+        return tuple(s // 4 for s in a.strides), offset // 4
+
+    # Basic slicing and axis permutations don't copy any memory
+    for key in ((1,), (slice(1, 3),), (slice(None, None, -2), 2),
+                (Ellipsis, slice(4, 0, -3)), (None, 2, Ellipsis, None),
+                (slice(None), -1, slice(1, 6, 2))):
+        w0, w1 = v0[key], v1[key]
+        strides, offset = dr.detail.tensor_layout(w0)
+        assert (tuple(strides), offset) == layout(w1)
+        assert w0.shape == w1.shape
+        assert np.all(w0.numpy() == w1)
+
+    assert v0[3, 4, 5].shape == () and v0[3, 4, 5].item() == v1[3, 4, 5]
+    assert v0[2:2].shape == (0, 5, 6)
+
+    # Views of views and arithmetic involving views
+    w0 = dr.moveaxis(v0[1:, ::-1], 0, 2)[:, 1::2]
+    w1 = np.moveaxis(v1[1:, ::-1], 0, 2)[:, 1::2]
+    strides, offset = dr.detail.tensor_layout(w0)
+    assert (tuple(strides), offset) == layout(w1)
+    assert np.all(w0.numpy() == w1)
+    assert np.all((w0 * 2 + w0).numpy() == w1 * 3)
+    assert np.all((w0 + v0[0, :3, :1, None]).numpy() == w1 + v1[0, :3, :1, None])
+
+    # Reading the flat array representation doesn't modify the view
+    layout0 = dr.detail.tensor_layout(w0)
+    assert np.all(w0.array.numpy() == w1.ravel())
+    assert dr.detail.tensor_layout(w0) == layout0
+
+    # Evaluating the view converts it into a contiguous tensor
+    dr.eval(w0)
+    strides, offset = dr.detail.tensor_layout(w0)
+    assert tuple(strides) == (9, 3, 1) and offset == 0
+    assert np.all(w0.numpy() == w1)
+
+    # Views have value semantics
+    x0 = v0[1]
+    v0[1] = 0
+    assert np.all(x0.numpy() == v1[1])
+
+    # Out-of-bounds views are rejected
+    with pytest.raises(RuntimeError, match='out of bounds'):
+        dr.detail.tensor_view(v0, (10,), (20,), 0)
+
+
+@pytest.test_arrays('is_tensor, jit, diff, float32')
+def test25_strided_view_grad(t):
+    x = t(dr.arange(dr.array_t(t), 12), (3, 4))
+    dr.enable_grad(x)
+    y = dr.moveaxis(x, 0, 1)[::-1, 1:]
+    assert y.shape == (4, 2)
+    dr.backward(dr.sum(y * y, axis=None))
+    assert dr.all(dr.grad(x) == t([0, 0, 0, 0, 8, 10, 12, 14,
+                                   16, 18, 20, 22], shape=(3, 4)), axis=None)
+
+@pytest.test_arrays('is_tensor, float32', 'is_tensor, float64')
+def test26_matmul(t):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(seed=0)
+    dtype = np.float32 if dr.type_v(t) == dr.VarType.Float32 else np.float64
+
+    configs = [
+        ((3, 4), (4, 5)),
+        ((1, 1), (1, 1)),
+        ((37, 300), (300, 41)),
+        ((4,), (4, 3)),
+        ((3, 4), (4,)),
+        ((4,), (4,)),
+        ((5, 3, 4), (5, 4, 2)),
+        ((5, 3, 4), (4, 2)),
+        ((3, 4), (5, 4, 2)),
+        ((2, 1, 3, 4), (1, 5, 4, 2)),
+        ((0, 4), (4, 3)),
+        ((3, 0), (0, 2)),
+    ]
+
+    for shape_a, shape_b in configs:
+        a_n = rng.random(shape_a, dtype=dtype)
+        b_n = rng.random(shape_b, dtype=dtype)
+        a, b = t(a_n), t(b_n)
+        c = a @ b
+        c_n = a_n @ b_n
+        assert c.shape == c_n.shape
+        assert np.allclose(c.numpy(), c_n, rtol=1e-5)
+
+    # Transposed views
+    a_n = rng.random((6, 5), dtype=dtype)
+    b_n = rng.random((6, 7), dtype=dtype)
+    a, b = t(a_n), t(b_n)
+    c = dr.moveaxis(a, 0, 1) @ b
+    assert np.allclose(c.numpy(), a_n.T @ b_n, rtol=1e-5)
+    c = dr.moveaxis(b, 0, 1) @ a
+    assert np.allclose(c.numpy(), b_n.T @ a_n, rtol=1e-5)
+
+    # Incompatible inner or batch dimensions
+    with pytest.raises(RuntimeError):
+        a @ b
+
+    with pytest.raises(RuntimeError):
+        dr.zeros(t, (2, 3, 4)) @ dr.zeros(t, (3, 4, 5))
+
+
+@pytest.test_arrays('is_tensor, jit, diff, float32')
+def test27_matmul_grad(t):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(seed=0)
+
+    for shape_a, shape_b in [((3, 4), (4, 5)), ((2, 3, 4), (4, 5)),
+                             ((3, 4), (2, 4, 5)), ((2, 3, 4), (2, 4, 5))]:
+        a_n = rng.random(shape_a, dtype=np.float32)
+        b_n = rng.random(shape_b, dtype=np.float32)
+        w_n = rng.random((a_n @ b_n).shape, dtype=np.float32)
+
+        # Reverse mode
+        a, b, w = t(a_n), t(b_n), t(w_n)
+        dr.enable_grad(a, b)
+        dr.backward(dr.sum((a @ b) * w, axis=None))
+
+        grad_a = w_n @ np.swapaxes(b_n, -1, -2)
+        grad_b = np.swapaxes(a_n, -1, -2) @ w_n
+        grad_a = grad_a.reshape((-1,) + shape_a).sum(axis=0) \
+            if grad_a.ndim > len(shape_a) else grad_a
+        grad_b = grad_b.reshape((-1,) + shape_b).sum(axis=0) \
+            if grad_b.ndim > len(shape_b) else grad_b
+        assert np.allclose(dr.grad(a).numpy(), grad_a, rtol=1e-5)
+        assert np.allclose(dr.grad(b).numpy(), grad_b, rtol=1e-5)
+
+        # Forward mode
+        a, b = t(a_n), t(b_n)
+        dr.enable_grad(a)
+        dr.set_grad(a, dr.ones(t, shape_a))
+        c = a @ b
+        dr.forward_to(c)
+        assert np.allclose(dr.grad(c).numpy(), np.ones(shape_a) @ b_n,
+                           rtol=1e-5)
+
+
+@pytest.test_arrays('is_tensor, jit, float32')
+def test28_advanced_indexing_views(t):
+    np = pytest.importorskip("numpy")
+    UInt32 = dr.uint32_array_t(dr.array_t(t))
+    Int32 = dr.int32_array_t(dr.array_t(t))
+
+    shape = (4, 5, 6)
+    v0 = t(dr.arange(dr.array_t(t), dr.prod(shape)), shape)
+    v1 = np.arange(dr.prod(shape), dtype=np.float32).reshape(shape)
+
+    w0 = dr.moveaxis(v0[1:, ::-1], 0, 2)[:, 1::2]
+    w1 = np.moveaxis(v1[1:, ::-1], 0, 2)[:, 1::2]
+    layout = dr.detail.tensor_layout(w0)
+
+    # Advanced indexing of contiguous tensors and views, including negative
+    # indices, integers, slices, 'None' and '...'
+    i0, i1 = UInt32(2, 0, 2, 1), np.array([2, 0, 2, 1])
+    j0, j1 = Int32(-1, 0), np.array([-1, 0])
+    for a0, a1 in ((v0, v1), (w0, w1)):
+        for k0, k1 in (((i0,), (i1,)),
+                       ((slice(None, None, -1), i0), (slice(None, None, -1), i1)),
+                       ((1, j0), (1, j1)),
+                       ((None, Ellipsis, i0[:2]), (None, Ellipsis, i1[:2])),
+                       ((j0, slice(1, 3), -1), (j1, slice(1, 3), -1))):
+            r0, r1 = a0[k0], a1[k1]
+            assert r0.shape == r1.shape
+            assert np.all(r0.numpy() == r1)
+
+    # The view was indexed without being materialized
+    strides, offset = dr.detail.tensor_layout(w0)
+    assert (tuple(strides), offset) == (tuple(layout[0]), layout[1])
+
+
+@pytest.test_arrays('is_tensor, jit, diff, float32')
+def test29_strided_view_suspend_grad(t):
+    # Reading a view while gradient tracking is suspended must not detach it
+    x = t(dr.arange(dr.array_t(t), 12), (3, 4))
+    dr.enable_grad(x)
+    y = x[1:, ::2]
+    layout = dr.detail.tensor_layout(y)
+
+    with dr.suspend_grad():
+        assert dr.all(y + 0 == t([4, 6, 8, 10], shape=(2, 2)), axis=None)
+        assert len(y.array) == 4
+
+    assert dr.detail.tensor_layout(y) == layout
+    dr.backward(dr.sum(y * y, axis=None))
+    assert dr.all(dr.grad(x) == t([0, 0, 0, 0, 8, 0, 12, 0,
+                                   16, 0, 20, 0], shape=(3, 4)), axis=None)
+
+
+@pytest.test_arrays('is_tensor, jit, float32')
+@pytest.mark.parametrize('mode', ['symbolic', 'evaluated'])
+def test30_strided_view_loop(t, mode):
+    # Reading a view within a loop body must not leak loop variables
+    UInt32 = dr.uint32_array_t(dr.array_t(t))
+    x = t(dr.arange(dr.array_t(t), 12), (3, 4))
+    y = dr.moveaxis(x, 0, 1)[::-1]
+    layout = dr.detail.tensor_layout(y)
+
+    def body(i, acc):
+        return i + 1, acc + dr.sum(y.array) + y[0, 0].array
+
+    i, acc = dr.while_loop(
+        state=(UInt32(0), dr.array_t(t)(0)),
+        cond=lambda i, acc: i < 3,
+        body=body,
+        mode=mode
+    )
+
+    assert dr.detail.tensor_layout(y) == layout
+    assert acc[0] == 3 * (66 + 3)
+    assert dr.all(y == t([3, 7, 11, 2, 6, 10, 1, 5, 9, 0, 4, 8],
+                         shape=(4, 3)), axis=None)
+
+    # Views that are part of the loop state are restored or updated as needed
+    def body2(i, y):
+        y += 1
+        return i + 1, y
+
+    z = dr.moveaxis(x, 0, 1)[::-1]
+    _, z2 = dr.while_loop(
+        state=(UInt32(0), z),
+        cond=lambda i, z: i < 2,
+        body=body2,
+        mode=mode
+    )
+    assert dr.all(z2 == t([5, 9, 13, 4, 8, 12, 3, 7, 11, 2, 6, 10],
+                          shape=(4, 3)), axis=None)
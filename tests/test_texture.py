@@ -898,3 +898,147 @@ def test26_tensor_getter_does_not_drop_gradient_tracking(t, texture_type, init,
     with dr.suspend_grad():
         tex.tensor() # Might mutate some internal state
     assert dr.grad_enabled(tex.tensor())
+
+
+@pytest.mark.parametrize("texture_type", ['Texture2f', 'Texture3f', 'Texture3f16'])
+@pytest.mark.parametrize("wrap_mode", wrap_modes)
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test27_tiled_layout(t, texture_type, wrap_mode):
+    # The tiled layout must be indistinguishable from the row-major one
+    mod = sys.modules[t.__module__]
+    TexType = getattr(mod, texture_type)
+    PCG32 = getattr(mod, 'PCG32')
+    dim = int(texture_type[7])
+    Array = getattr(mod, f'Array{dim}f')
+
+    shape = [13, 6, 9][:dim]
+    for ch in [1, 3, 4]:
+        tex_ref = TexType(shape, ch, use_accel=False, wrap_mode=wrap_mode)
+        tex = TexType(shape, ch, use_accel=False, wrap_mode=wrap_mode,
+                      layout=dr.TextureLayout.Tiled)
+        assert tex.layout() == dr.TextureLayout.Tiled
+
+        StorageType = dr.array_t(tex.value())
+        tex_data = StorageType(PCG32(13 * 6 * ch * (9 if dim == 3 else 1)).next_float32())
+        tex_ref.set_value(tex_data)
+        tex.set_value(tex_data)
+
+        assert dr.all(tex.value() == tex_data)
+        assert tex.tensor().shape == tuple(shape + [ch])
+
+        rng = PCG32(1000)
+        pos = Array([rng.next_float32() * 1.4 - 0.2 for _ in range(dim)])
+
+        assert dr.allclose(tex.eval(pos), tex_ref.eval(pos))
+        assert dr.allclose(tex.eval_cubic(pos), tex_ref.eval_cubic(pos))
+        for a, b in zip(tex.eval_fetch(pos), tex_ref.eval_fetch(pos)):
+            assert dr.allclose(a, b)
+
+        # Changing the resolution re-tiles the texture
+        tensor = dr.full(type(tex.tensor()), 1, shape=[5] * dim + [ch])
+        tex.set_tensor(tensor)
+        assert tex.layout() == dr.TextureLayout.Tiled
+        assert dr.allclose(tex.eval(pos), 1)
+
+    # 1D textures always use the row-major layout
+    Tex1 = getattr(mod, 'Texture1f')
+    tex = Tex1([4], 1, layout=dr.TextureLayout.Tiled)
+    assert tex.layout() == dr.TextureLayout.RowMajor
+
+
+@pytest.test_arrays("is_diff, float32, shape=(*)")
+@pytest.skip_on(RuntimeError, "backend does not support the requested type of atomic reduction")
+def test28_tiled_layout_grad(t):
+    mod = sys.modules[t.__module__]
+    Texture2f = getattr(mod, 'Texture2f')
+    Array2f = getattr(mod, 'Array2f')
+    TensorXf = getattr(mod, 'TensorXf')
+
+    tensor = TensorXf(dr.arange(t, 9 * 10 * 2), shape=(9, 10, 2))
+    dr.enable_grad(tensor)
+    tex = Texture2f(tensor, use_accel=False, layout=dr.TextureLayout.Tiled)
+
+    # Texel (row 8, column 9) lands in a partially filled tile
+    pos = Array2f(9.5 / 10, 8.5 / 9)
+    result = tex.eval(pos)
+    assert dr.allclose(result[1], 8 * 20 + 9 * 2 + 1)
+    dr.backward(result[1])
+
+    grad = dr.zeros(t, 9 * 10 * 2)
+    grad[8 * 20 + 9 * 2 + 1] = 1
+    assert dr.all(tensor.grad.array == grad)
+
+
+@pytest.test_arrays("is_jit, float32, shape=(*)")
+def test29_mip_texture(t):
+    mod = sys.modules[t.__module__]
+    TensorXf = getattr(mod, 'TensorXf')
+    Array2f = getattr(mod, 'Array2f')
+    PCG32 = getattr(mod, 'PCG32')
+
+    rng = PCG32(16 * 8 * 2)
+    tensor = TensorXf(rng.next_float32(), shape=(16, 8, 2))
+    tex = dr.texture.MipTexture(tensor, use_accel=False)
+
+    # 16x8 -> 8x4 -> 4x2 -> 2x1 -> 1x1
+    assert tex.levels == 5
+    assert tex.tensor(1).shape == (8, 4, 2)
+    assert tex.tensor(4).shape == (1, 1, 2)
+
+    # Box-filtered levels average blocks of texels
+    for c in range(2):
+        mean = dr.mean(tensor[:, :, c].array)
+        assert dr.allclose(tex.tensor(4).array[c], mean)
+    ref = (tensor[0, 0, :] + tensor[0, 1, :] + tensor[1, 0, :] + tensor[1, 1, :]) / 4
+    assert dr.allclose(tex.tensor(1)[0, 0, :], ref)
+
+    pos = Array2f(PCG32(100).next_float32(), PCG32(100, 3).next_float32())
+    l0 = tex.level(0).eval(pos)
+    l1 = tex.level(1).eval(pos)
+
+    # Explicit scalar level of detail
+    assert dr.allclose(tex.eval(pos), l0)
+    assert dr.allclose(tex.eval(pos, lod=0.25), [dr.lerp(a, b, .25) for a, b in zip(l0, l1)])
+    assert dr.allclose(tex.eval(pos, lod=10), tex.level(4).eval(pos))
+
+    # Per-lane level of detail must match the scalar version
+    lod = dr.arange(t, 100) / 99 * 4
+    out = tex.eval(pos, lod)
+    for i in [0, 17, 50, 99]:
+        ref = tex.eval(Array2f(pos.x[i], pos.y[i]), float(lod[i]))
+        assert dr.allclose([o[i] for o in out], [r[0] for r in ref])
+
+    # Isotropic footprint covering 4x4 texels -> level 2
+    dpdx, dpdy = Array2f(4 / 8, 0), Array2f(0, 4 / 16)
+    assert dr.allclose(tex.lod(dpdx, dpdy), 2)
+    assert dr.allclose(tex.eval_grad(pos, dpdx, dpdy), tex.level(2).eval(pos))
+    assert dr.allclose(tex.eval_aniso(pos, dpdx, dpdy), tex.level(2).eval(pos))
+
+    # Anisotropic footprint (4x1 texels) -> 4 lookups on level 0
+    dpdx, dpdy = Array2f(4 / 8, 0), Array2f(0, 1 / 16)
+    ref = [0, 0]
+    for k in range(4):
+        pos_k = Array2f(pos.x + ((k + .5) / 4 - .5) * 4 / 8, pos.y)
+        ref = [r + v / 4 for r, v in zip(ref, tex.level(0).eval(pos_k))]
+    assert dr.allclose(tex.eval_aniso(pos, dpdx, dpdy), ref)
+
+    # Clamping the anisotropy selects a coarser level
+    out = tex.eval_aniso(pos, dpdx, dpdy, max_anisotropy=1)
+    assert dr.allclose(out, tex.level(2).eval(pos))
+
+
+@pytest.test_arrays("is_diff, float32, shape=(*)")
+def test30_mip_texture_grad(t):
+    mod = sys.modules[t.__module__]
+    TensorXf = getattr(mod, 'TensorXf')
+    Array2f = getattr(mod, 'Array2f')
+
+    tensor = TensorXf(dr.arange(t, 8 * 8), shape=(8, 8, 1))
+    dr.enable_grad(tensor)
+    tex = dr.texture.MipTexture(tensor, use_accel=False)
+
+    # The coarsest level averages all texels
+    out = tex.eval(Array2f(0.3, 0.6), lod=3)[0]
+    assert dr.allclose(out, dr.mean(dr.arange(t, 8 * 8)))
+    dr.backward(out)
+    assert dr.allclose(tensor.grad.array, 1 / 64)
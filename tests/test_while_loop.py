@@ -771,3 +771,44 @@ def test33_tensor_loop_ad(t, mode):
     dr.backward(y)
     assert x.grad.shape == (3,)
     assert dr.allclose(x.grad, t([10, 10, 10]))
+
+
+@pytest.mark.parametrize('mode', ['evaluated', 'symbolic'])
+@pytest.test_arrays('uint32,is_jit,shape=(*)')
+def test34_nested_state_labels(t, mode):
+    # Nested state is tracked across many read/write cycles, and errors
+    # identify the offending variable by its full label
+    def body(i, state):
+        state = dr.if_stmt(
+            args=(state, i),
+            cond=i < 2,
+            true_fn=lambda state, i: {'a': [state['a'][0] + i, state['a'][1]],
+                                      'b': state['b']},
+            false_fn=lambda state, i: state,
+            mode=mode
+        )
+        return i + 1, state
+
+    i, state = dr.while_loop(
+        state=(t(0, 1, 2), {'a': [t(0, 1, 2), t(5)], 'b': (t(1, 2, 3),)}),
+        cond=lambda i, state: i < 4,
+        body=body,
+        labels=('i', 'state'),
+        mode=mode
+    )
+
+    assert dr.all(i == t(4, 4, 4))
+    assert dr.all(state['a'][0] == t(1, 2, 2))
+    assert dr.all(state['a'][1] == t(5))
+    assert dr.all(state['b'][0] == t(1, 2, 3))
+
+    with pytest.raises(RuntimeError) as e:
+        dr.while_loop(
+            state=(t(0, 1, 2), {'a': [t(0, 1, 2), t(5, 6, 7)]}),
+            cond=lambda i, state: i < 4,
+            body=lambda i, state: (i + 1, {'a': [state['a'][0], t(1, 2)]}),
+            labels=('i', 'state'),
+            mode=mode
+        )
+
+    assert "state variable 'state['a'][1]'" in str(e.value)